@@ -19,6 +19,8 @@
 
 #include "ActionExecutor.h"
 
+#include <QtCore/QTimerEvent>
+
 namespace Otter
 {
 
@@ -84,6 +86,27 @@ void ActionExecutor::Object::disconnectSignals(const QObject *receiver, const QM
 	}
 }
 
+void ActionExecutor::Object::addStateReceiver(QObject *receiver, const QMetaMethod &updateStateMethod, int identifier, int category)
+{
+	if (receiver && m_object)
+	{
+		ActionsStateDispatcher::getDispatcher(m_object.data())->addReceiver(receiver, updateStateMethod, identifier, category);
+	}
+}
+
+void ActionExecutor::Object::removeStateReceiver(QObject *receiver)
+{
+	if (receiver && m_object)
+	{
+		ActionsStateDispatcher *dispatcher(ActionsStateDispatcher::getDispatcher(m_object.data(), false));
+
+		if (dispatcher)
+		{
+			dispatcher->removeReceiver(receiver);
+		}
+	}
+}
+
 void ActionExecutor::Object::triggerAction(int identifier, const QVariantMap &parameters, ActionsManager::TriggerType trigger)
 {
 	if (!m_object.isNull())
@@ -135,4 +158,172 @@ bool ActionExecutor::isAboutToClose() const
 	return false;
 }
 
+QHash<QObject*, ActionsStateDispatcher*> ActionsStateDispatcher::m_dispatchers;
+
+ActionsStateDispatcher::ActionsStateDispatcher(QObject *parent) : QObject(parent),
+	m_updateTimer(0)
+{
+	const QMetaObject *executorMetaObject(parent->metaObject());
+	const QMetaMethod actionsStateChangedSignal(executorMetaObject->method(executorMetaObject->indexOfSignal("actionsStateChanged()")));
+	const QMetaMethod arbitraryActionsStateChangedSignal(executorMetaObject->method(executorMetaObject->indexOfSignal("arbitraryActionsStateChanged(QVector<int>)")));
+	const QMetaMethod categorizedActionsStateChangedSignal(executorMetaObject->method(executorMetaObject->indexOfSignal("categorizedActionsStateChanged(QVector<int>)")));
+
+	if (actionsStateChangedSignal.isValid())
+	{
+		connect(parent, actionsStateChangedSignal, this, metaObject()->method(metaObject()->indexOfSlot("handleActionsStateChanged()")));
+	}
+
+	if (arbitraryActionsStateChangedSignal.isValid())
+	{
+		connect(parent, arbitraryActionsStateChangedSignal, this, metaObject()->method(metaObject()->indexOfSlot("handleArbitraryActionsStateChanged(QVector<int>)")));
+	}
+
+	if (categorizedActionsStateChangedSignal.isValid())
+	{
+		connect(parent, categorizedActionsStateChangedSignal, this, metaObject()->method(metaObject()->indexOfSlot("handleCategorizedActionsStateChanged(QVector<int>)")));
+	}
+
+	m_dispatchers[parent] = this;
+}
+
+ActionsStateDispatcher::~ActionsStateDispatcher()
+{
+	QHash<QObject*, ActionsStateDispatcher*>::iterator iterator(m_dispatchers.begin());
+
+	while (iterator != m_dispatchers.end())
+	{
+		if (iterator.value() == this)
+		{
+			iterator = m_dispatchers.erase(iterator);
+		}
+		else
+		{
+			++iterator;
+		}
+	}
+}
+
+void ActionsStateDispatcher::timerEvent(QTimerEvent *event)
+{
+	if (event->timerId() == m_updateTimer)
+	{
+		killTimer(m_updateTimer);
+
+		m_updateTimer = 0;
+
+		const QSet<QObject*> receivers(m_pendingReceivers);
+
+		m_pendingReceivers.clear();
+
+		QSet<QObject*>::const_iterator iterator;
+
+		for (iterator = receivers.constBegin(); iterator != receivers.constEnd(); ++iterator)
+		{
+			if (m_receivers.contains(*iterator))
+			{
+				m_receivers[*iterator].updateStateMethod.invoke(*iterator, Qt::DirectConnection);
+			}
+		}
+	}
+}
+
+void ActionsStateDispatcher::addReceiver(QObject *receiver, const QMetaMethod &updateStateMethod, int identifier, int category)
+{
+	removeReceiver(receiver);
+
+	Receiver information;
+	information.updateStateMethod = updateStateMethod;
+	information.identifier = identifier;
+	information.category = category;
+
+	m_receivers[receiver] = information;
+
+	m_identifierReceivers.insert(identifier, receiver);
+	m_categoryReceivers.insert(category, receiver);
+
+	connect(receiver, &QObject::destroyed, this, &ActionsStateDispatcher::handleReceiverDestroyed);
+}
+
+void ActionsStateDispatcher::removeReceiver(QObject *receiver)
+{
+	if (!m_receivers.contains(receiver))
+	{
+		return;
+	}
+
+	const Receiver information(m_receivers.take(receiver));
+
+	m_identifierReceivers.remove(information.identifier, receiver);
+	m_categoryReceivers.remove(information.category, receiver);
+	m_pendingReceivers.remove(receiver);
+
+	disconnect(receiver, &QObject::destroyed, this, &ActionsStateDispatcher::handleReceiverDestroyed);
+}
+
+void ActionsStateDispatcher::scheduleUpdate(QObject *receiver)
+{
+	m_pendingReceivers.insert(receiver);
+
+	if (m_updateTimer == 0)
+	{
+		m_updateTimer = startTimer(0);
+	}
+}
+
+void ActionsStateDispatcher::handleActionsStateChanged()
+{
+	QHash<QObject*, Receiver>::const_iterator iterator;
+
+	for (iterator = m_receivers.constBegin(); iterator != m_receivers.constEnd(); ++iterator)
+	{
+		scheduleUpdate(iterator.key());
+	}
+}
+
+void ActionsStateDispatcher::handleArbitraryActionsStateChanged(const QVector<int> &identifiers)
+{
+	for (int i = 0; i < identifiers.count(); ++i)
+	{
+		const QList<QObject*> receivers(m_identifierReceivers.values(identifiers.at(i)));
+
+		for (int j = 0; j < receivers.count(); ++j)
+		{
+			scheduleUpdate(receivers.at(j));
+		}
+	}
+}
+
+void ActionsStateDispatcher::handleCategorizedActionsStateChanged(const QVector<int> &categories)
+{
+	for (int i = 0; i < categories.count(); ++i)
+	{
+		const QList<QObject*> receivers(m_categoryReceivers.values(categories.at(i)));
+
+		for (int j = 0; j < receivers.count(); ++j)
+		{
+			scheduleUpdate(receivers.at(j));
+		}
+	}
+}
+
+void ActionsStateDispatcher::handleReceiverDestroyed(QObject *object)
+{
+	removeReceiver(object);
+}
+
+ActionsStateDispatcher* ActionsStateDispatcher::getDispatcher(QObject *executor, bool create)
+{
+	if (!executor)
+	{
+		return nullptr;
+	}
+
+	if (!m_dispatchers.contains(executor) && create)
+	{
+		new ActionsStateDispatcher(executor);
+	}
+
+	return m_dispatchers.value(executor, nullptr);
+}
+
 }
@@ -24,6 +24,7 @@
 
 #include <QtCore/QMetaMethod>
 #include <QtCore/QPointer>
+#include <QtCore/QSet>
 
 namespace Otter
 {
@@ -40,6 +41,8 @@ public:
 
 		void connectSignals(const QObject *receiver, const QMetaMethod *actionsStateChangedMethod, const QMetaMethod *arbitraryActionsStateChangedMethod, const QMetaMethod *categorizedActionsStateChangedMethod);
 		void disconnectSignals(const QObject *receiver, const QMetaMethod *actionsStateChangedMethod, const QMetaMethod *arbitraryActionsStateChangedMethod, const QMetaMethod *categorizedActionsStateChangedMethod);
+		void addStateReceiver(QObject *receiver, const QMetaMethod &updateStateMethod, int identifier, int category);
+		void removeStateReceiver(QObject *receiver);
 		void triggerAction(int identifier, const QVariantMap &parameters = {}, ActionsManager::TriggerType trigger = ActionsManager::UnknownTrigger);
 		QObject* getObject() const;
 		Object& operator=(const Object &other);
@@ -59,6 +62,46 @@ public:
 	virtual bool isAboutToClose() const;
 };
 
+class ActionsStateDispatcher final : public QObject
+{
+	Q_OBJECT
+
+public:
+	~ActionsStateDispatcher();
+
+	void addReceiver(QObject *receiver, const QMetaMethod &updateStateMethod, int identifier, int category);
+	void removeReceiver(QObject *receiver);
+	static ActionsStateDispatcher* getDispatcher(QObject *executor, bool create = true);
+
+protected:
+	struct Receiver final
+	{
+		QMetaMethod updateStateMethod;
+		int identifier = -1;
+		int category = -1;
+	};
+
+	explicit ActionsStateDispatcher(QObject *parent);
+
+	void timerEvent(QTimerEvent *event) override;
+	void scheduleUpdate(QObject *receiver);
+
+protected slots:
+	void handleActionsStateChanged();
+	void handleArbitraryActionsStateChanged(const QVector<int> &identifiers);
+	void handleCategorizedActionsStateChanged(const QVector<int> &categories);
+	void handleReceiverDestroyed(QObject *object);
+
+private:
+	QHash<QObject*, Receiver> m_receivers;
+	QMultiHash<int, QObject*> m_identifierReceivers;
+	QMultiHash<int, QObject*> m_categoryReceivers;
+	QSet<QObject*> m_pendingReceivers;
+	int m_updateTimer;
+
+	static QHash<QObject*, ActionsStateDispatcher*> m_dispatchers;
+};
+
 }
 
 #endif
@@ -154,7 +154,7 @@ void AddressCompletionModel::updateModel()
 
 	if (m_types.testFlag(HistoryCompletionType))
 	{
-		const QVector<HistoryModel::HistoryEntryMatch> entries(HistoryManager::findEntries(m_filter));
+		const QVector<HistoryModel::HistoryEntryMatch> entries(HistoryManager::findEntries(m_filter, false, 20));
 
 		if (m_showCompletionCategories && !entries.isEmpty())
 		{
@@ -163,7 +163,10 @@ void AddressCompletionModel::updateModel()
 
 		for (int i = 0; i < entries.count(); ++i)
 		{
-			completions.append(CompletionEntry(entries.at(i).entry->getUrl(), entries.at(i).entry->getTitle(), entries.at(i).match, entries.at(i).entry->getIcon(), entries.at(i).entry->getTimeVisited(), (entries.at(i).isTypedIn ? CompletionEntry::TypedInHistoryType : CompletionEntry::HistoryType)));
+			CompletionEntry completionEntry(entries.at(i).entry->getUrl(), entries.at(i).entry->getTitle(), entries.at(i).match, entries.at(i).entry->getIcon(), entries.at(i).entry->getTimeVisited(), (entries.at(i).isTypedIn ? CompletionEntry::TypedInHistoryType : CompletionEntry::HistoryType));
+			completionEntry.score = entries.at(i).score;
+
+			completions.append(completionEntry);
 		}
 	}
 
@@ -178,7 +181,10 @@ void AddressCompletionModel::updateModel()
 
 		for (int i = 0; i < entries.count(); ++i)
 		{
-			completions.append(CompletionEntry(entries.at(i).entry->getUrl(), entries.at(i).entry->getTitle(), entries.at(i).match, entries.at(i).entry->getIcon(), entries.at(i).entry->getTimeVisited(), CompletionEntry::TypedInHistoryType));
+			CompletionEntry completionEntry(entries.at(i).entry->getUrl(), entries.at(i).entry->getTitle(), entries.at(i).match, entries.at(i).entry->getIcon(), entries.at(i).entry->getTimeVisited(), CompletionEntry::TypedInHistoryType);
+			completionEntry.score = entries.at(i).score;
+
+			completions.append(completionEntry);
 		}
 	}
 
@@ -284,6 +290,8 @@ QVariant AddressCompletionModel::data(const QModelIndex &index, int role) const
 				return m_completions.at(index.row()).timeVisited;
 			case TypeRole:
 				return static_cast<int>(m_completions.at(index.row()).type);
+			case ScoreRole:
+				return m_completions.at(index.row()).score;
 			default:
 				return {};
 		}
@@ -56,7 +56,8 @@ public:
 		MatchRole,
 		KeywordRole,
 		TypeRole,
-		TimeVisitedRole
+		TimeVisitedRole,
+		ScoreRole
 	};
 
 	struct CompletionEntry final
@@ -81,6 +82,7 @@ public:
 		QIcon icon;
 		QDateTime timeVisited;
 		EntryType type = UnknownType;
+		qreal score = 0;
 
 		explicit CompletionEntry(const QUrl &urlValue, const QString &titleValue, const QString &matchValue, const QIcon &iconValue, const QDateTime timeVisitedValue, EntryType typeValue) : title(titleValue), match(matchValue), url(urlValue), icon(iconValue), timeVisited(timeVisitedValue), type(typeValue)
 		{
@@ -36,9 +36,11 @@
 #include "SearchEnginesManager.h"
 #include "SettingsManager.h"
 #include "SpellCheckManager.h"
+#include "SuspensionManager.h"
 #include "TasksManager.h"
 #include "ToolBarsManager.h"
 #include "ThemesManager.h"
+#include "ThumbnailsManager.h"
 #include "TransfersManager.h"
 #include "Utils.h"
 #include "Updater.h"
@@ -436,6 +438,10 @@ Application::Application(int &argc, char **argv) : QApplication(argc, argv), Act
 
 	SpellCheckManager::createInstance();
 
+	SuspensionManager::createInstance();
+
+	ThumbnailsManager::createInstance();
+
 	ToolBarsManager::createInstance();
 
 	TransfersManager::createInstance();
@@ -0,0 +1,133 @@
+/**************************************************************************
+* Otter Browser: Web browser controlled by the user, not vice-versa.
+* Copyright (C) 2019 Michal Dutkiewicz aka Emdek <michal@emdek.pl>
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+**************************************************************************/
+
+#include "BlockedRequestsLog.h"
+
+namespace Otter
+{
+
+BlockedRequestsLog::BlockedRequestsLog(int limit) : m_position(0),
+	m_amount(0),
+	m_limit(qMax(1, limit))
+{
+}
+
+void BlockedRequestsLog::addRequest(const NetworkManager::ResourceInformation &request)
+{
+	if (m_requests.count() < m_limit)
+	{
+		m_requests.append(request);
+	}
+	else
+	{
+		m_requests[m_position] = request;
+
+		m_position = ((m_position + 1) % m_limit);
+	}
+
+	++m_amount;
+	++m_profileAmounts[request.metaData.value(NetworkManager::ContentBlockingProfileMetaData, -1).toInt()];
+	++m_ruleAmounts[request.metaData.value(NetworkManager::ContentBlockingRuleMetaData).toString()];
+}
+
+void BlockedRequestsLog::addElement(const QString &url)
+{
+	if (!m_elementsSet.contains(url))
+	{
+		m_elementsSet.insert(url);
+		m_elements.append(url);
+	}
+}
+
+void BlockedRequestsLog::clear()
+{
+	m_requests.clear();
+	m_elements.clear();
+	m_elementsSet.clear();
+	m_profileAmounts.clear();
+	m_ruleAmounts.clear();
+
+	m_position = 0;
+	m_amount = 0;
+}
+
+void BlockedRequestsLog::setLimit(int limit)
+{
+	limit = qMax(1, limit);
+
+	if (limit == m_limit)
+	{
+		return;
+	}
+
+	const QVector<NetworkManager::ResourceInformation> requests(getRequests((m_amount - limit), limit));
+
+	m_requests = requests;
+	m_position = 0;
+	m_limit = limit;
+}
+
+QStringList BlockedRequestsLog::getElements() const
+{
+	return m_elements;
+}
+
+QVector<NetworkManager::ResourceInformation> BlockedRequestsLog::getRequests(int from, int amount) const
+{
+	const int first(m_amount - m_requests.count());
+	const int start(qMax(first, from));
+	const int end((amount < 0) ? m_amount : qMin(m_amount, (from + amount)));
+	QVector<NetworkManager::ResourceInformation> requests;
+
+	if (start >= end)
+	{
+		return requests;
+	}
+
+	requests.reserve(end - start);
+
+	for (int i = start; i < end; ++i)
+	{
+		requests.append(m_requests.at((m_position + (i - first)) % m_requests.count()));
+	}
+
+	return requests;
+}
+
+int BlockedRequestsLog::getAmount() const
+{
+	return m_amount;
+}
+
+int BlockedRequestsLog::getProfileAmount(int profile) const
+{
+	return m_profileAmounts.value(profile, 0);
+}
+
+int BlockedRequestsLog::getRuleAmount(const QString &rule) const
+{
+	return m_ruleAmounts.value(rule, 0);
+}
+
+int BlockedRequestsLog::getLimit() const
+{
+	return m_limit;
+}
+
+}
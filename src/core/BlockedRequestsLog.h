@@ -0,0 +1,59 @@
+/**************************************************************************
+* Otter Browser: Web browser controlled by the user, not vice-versa.
+* Copyright (C) 2019 Michal Dutkiewicz aka Emdek <michal@emdek.pl>
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+**************************************************************************/
+
+#ifndef OTTER_BLOCKEDREQUESTSLOG_H
+#define OTTER_BLOCKEDREQUESTSLOG_H
+
+#include "NetworkManager.h"
+
+#include <QtCore/QSet>
+
+namespace Otter
+{
+
+class BlockedRequestsLog final
+{
+public:
+	explicit BlockedRequestsLog(int limit = 1000);
+
+	void addRequest(const NetworkManager::ResourceInformation &request);
+	void addElement(const QString &url);
+	void clear();
+	void setLimit(int limit);
+	QStringList getElements() const;
+	QVector<NetworkManager::ResourceInformation> getRequests(int from = 0, int amount = -1) const;
+	int getAmount() const;
+	int getProfileAmount(int profile) const;
+	int getRuleAmount(const QString &rule) const;
+	int getLimit() const;
+
+private:
+	QVector<NetworkManager::ResourceInformation> m_requests;
+	QStringList m_elements;
+	QSet<QString> m_elementsSet;
+	QHash<int, int> m_profileAmounts;
+	QHash<QString, int> m_ruleAmounts;
+	int m_position;
+	int m_amount;
+	int m_limit;
+};
+
+}
+
+#endif
@@ -22,7 +22,9 @@
 #include "SessionsManager.h"
 #include "Utils.h"
 
+#include <QtCore/QDataStream>
 #include <QtCore/QDateTime>
+#include <QtCore/QFile>
 
 namespace Otter
 {
@@ -32,7 +34,8 @@ BookmarksModel* BookmarksManager::m_model(nullptr);
 qulonglong BookmarksManager::m_lastUsedFolder(0);
 
 BookmarksManager::BookmarksManager(QObject *parent) : QObject(parent),
-	m_saveTimer(0)
+	m_saveTimer(0),
+	m_visitsTimer(0)
 {
 }
 
@@ -44,9 +47,49 @@ void BookmarksManager::timerEvent(QTimerEvent *event)
 
 		m_saveTimer = 0;
 
-		if (m_model)
+		if (m_model && m_model->save(SessionsManager::getWritableDataPath(QLatin1String("bookmarks.xbel"))))
 		{
-			m_model->save(SessionsManager::getWritableDataPath(QLatin1String("bookmarks.xbel")));
+			QFile::remove(SessionsManager::getWritableDataPath(QLatin1String("bookmarksVisits.dat")));
+		}
+	}
+	else if (event->timerId() == m_visitsTimer)
+	{
+		killTimer(m_visitsTimer);
+
+		m_visitsTimer = 0;
+
+		const QSet<quint64> identifiers(m_modifiedVisits);
+
+		m_modifiedVisits.clear();
+
+		if (!m_model || SessionsManager::isReadOnly())
+		{
+			return;
+		}
+
+		QFile file(SessionsManager::getWritableDataPath(QLatin1String("bookmarksVisits.dat")));
+
+		if (!file.open(QIODevice::WriteOnly | QIODevice::Append))
+		{
+			return;
+		}
+
+		QDataStream stream(&file);
+		QSet<quint64>::const_iterator iterator;
+
+		for (iterator = identifiers.begin(); iterator != identifiers.end(); ++iterator)
+		{
+			const BookmarksModel::Bookmark *bookmark(m_model->getBookmark(*iterator));
+
+			if (bookmark)
+			{
+				stream << *iterator << static_cast<qint32>(bookmark->getVisits()) << bookmark->getTimeVisited().toMSecsSinceEpoch();
+			}
+		}
+
+		if (file.size() > 65536)
+		{
+			scheduleSave();
 		}
 	}
 }
@@ -70,6 +113,29 @@ void BookmarksManager::ensureInitialized()
 	{
 		m_model = new BookmarksModel(SessionsManager::getWritableDataPath(QLatin1String("bookmarks.xbel")), BookmarksModel::BookmarksMode, m_instance);
 
+		QFile file(SessionsManager::getWritableDataPath(QLatin1String("bookmarksVisits.dat")));
+
+		if (file.open(QIODevice::ReadOnly))
+		{
+			QDataStream stream(&file);
+
+			while (!stream.atEnd())
+			{
+				quint64 identifier(0);
+				qint32 visits(0);
+				qint64 time(0);
+
+				stream >> identifier >> visits >> time;
+
+				if (stream.status() != QDataStream::Ok)
+				{
+					break;
+				}
+
+				m_model->setVisits(m_model->getBookmark(identifier), visits, QDateTime::fromMSecsSinceEpoch(time, Qt::UTC));
+			}
+		}
+
 		connect(m_model, &BookmarksModel::modelModified, m_instance, &BookmarksManager::scheduleSave);
 	}
 }
@@ -82,6 +148,16 @@ void BookmarksManager::scheduleSave()
 	}
 }
 
+void BookmarksManager::scheduleVisitsSave(quint64 identifier)
+{
+	m_modifiedVisits.insert(identifier);
+
+	if (m_visitsTimer == 0)
+	{
+		m_visitsTimer = startTimer(1000);
+	}
+}
+
 void BookmarksManager::updateVisits(const QUrl &url)
 {
 	ensureInitialized();
@@ -93,11 +169,11 @@ void BookmarksManager::updateVisits(const QUrl &url)
 		for (int i = 0; i < bookmarks.count(); ++i)
 		{
 			BookmarksModel::Bookmark *bookmark(bookmarks.at(i));
-			bookmark->setData((bookmark->getVisits() + 1), BookmarksModel::VisitsRole);
-			bookmark->setData(QDateTime::currentDateTimeUtc(), BookmarksModel::TimeVisitedRole);
-		}
 
-		m_instance->scheduleSave();
+			m_model->setVisits(bookmark, (bookmark->getVisits() + 1), QDateTime::currentDateTimeUtc());
+
+			m_instance->scheduleVisitsSave(bookmark->getIdentifier());
+		}
 	}
 }
 
@@ -56,9 +56,12 @@ protected:
 
 protected slots:
 	void scheduleSave();
+	void scheduleVisitsSave(quint64 identifier);
 
 private:
+	QSet<quint64> m_modifiedVisits;
 	int m_saveTimer;
+	int m_visitsTimer;
 
 	static BookmarksManager *m_instance;
 	static BookmarksModel *m_model;
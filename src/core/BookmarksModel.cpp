@@ -338,7 +338,8 @@ BookmarksModel::BookmarksModel(const QString &path, FormatMode mode, QObject *pa
 	m_rootItem(new Bookmark()),
 	m_trashItem(new Bookmark()),
 	m_importTargetItem(nullptr),
-	m_mode(mode)
+	m_mode(mode),
+	m_isUpdatingVisits(false)
 {
 	m_rootItem->setData(RootBookmark, TypeRole);
 	m_rootItem->setDragEnabled(false);
@@ -392,7 +393,13 @@ BookmarksModel::BookmarksModel(const QString &path, FormatMode mode, QObject *pa
 		}
 	}
 
-	connect(this, &BookmarksModel::itemChanged, this, &BookmarksModel::modelModified);
+	connect(this, &BookmarksModel::itemChanged, this, [&]()
+	{
+		if (!m_isUpdatingVisits)
+		{
+			emit modelModified();
+		}
+	});
 	connect(this, &BookmarksModel::rowsInserted, this, &BookmarksModel::modelModified);
 	connect(this, &BookmarksModel::rowsInserted, this, &BookmarksModel::notifyBookmarkModified);
 	connect(this, &BookmarksModel::rowsRemoved, this, &BookmarksModel::modelModified);
@@ -531,6 +538,23 @@ void BookmarksModel::removeBookmark(Bookmark *bookmark)
 	emit modelModified();
 }
 
+void BookmarksModel::setVisits(Bookmark *bookmark, int visits, const QDateTime &time)
+{
+	if (!bookmark)
+	{
+		return;
+	}
+
+	m_isUpdatingVisits = true;
+
+	bookmark->setItemData(visits, VisitsRole);
+	bookmark->setItemData(time, TimeVisitedRole);
+
+	m_isUpdatingVisits = false;
+
+	emit bookmarkModified(bookmark);
+}
+
 void BookmarksModel::readBookmark(QXmlStreamReader *reader, Bookmark *parent)
 {
 	Bookmark *bookmark(nullptr);
@@ -113,6 +113,7 @@ public:
 	void trashBookmark(Bookmark *bookmark);
 	void restoreBookmark(Bookmark *bookmark);
 	void removeBookmark(Bookmark *bookmark);
+	void setVisits(Bookmark *bookmark, int visits, const QDateTime &time);
 	Bookmark* addBookmark(BookmarkType type, const QMap<int, QVariant> &metaData = {}, Bookmark *parent = nullptr, int index = -1);
 	Bookmark* getBookmarkByKeyword(const QString &keyword) const;
 	Bookmark* getBookmarkByPath(const QString &path) const;
@@ -163,6 +164,7 @@ private:
 	QHash<QString, Bookmark*> m_keywords;
 	QMap<quint64, Bookmark*> m_identifiers;
 	FormatMode m_mode;
+	bool m_isUpdatingVisits;
 
 signals:
 	void bookmarkAdded(Bookmark *bookmark);
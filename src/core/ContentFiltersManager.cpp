@@ -520,7 +520,7 @@ ContentFiltersManager::CheckResult ContentFiltersManager::checkUrl(const QVector
 	return result;
 }
 
-ContentFiltersManager::CosmeticFiltersResult ContentFiltersManager::getCosmeticFilters(const QVector<int> &profiles, const QUrl &requestUrl)
+ContentFiltersManager::CosmeticFiltersResult ContentFiltersManager::getCosmeticFilters(const QVector<int> &profiles, const QUrl &requestUrl, bool isDomainOnly)
 {
 	if (profiles.isEmpty() || m_cosmeticFiltersMode == NoFilters)
 	{
@@ -535,6 +535,8 @@ ContentFiltersManager::CosmeticFiltersResult ContentFiltersManager::getCosmeticF
 	}
 
 	CosmeticFiltersResult result;
+	result.mode = ((m_cosmeticFiltersMode == DomainOnlyFilters) ? DomainOnlyFilters : mode);
+
 	const QStringList domains(createSubdomainList(requestUrl.host()));
 
 	for (int i = 0; i < profiles.count(); ++i)
@@ -543,7 +545,7 @@ ContentFiltersManager::CosmeticFiltersResult ContentFiltersManager::getCosmeticF
 
 		if (index >= 0 && index < m_contentBlockingProfiles.count())
 		{
-			const CosmeticFiltersResult profileResult(m_contentBlockingProfiles.at(index)->getCosmeticFilters(domains, (mode == DomainOnlyFilters)));
+			const CosmeticFiltersResult profileResult(m_contentBlockingProfiles.at(index)->getCosmeticFilters(domains, (isDomainOnly || mode == DomainOnlyFilters)));
 
 			result.rules.append(profileResult.rules);
 			result.exceptions.append(profileResult.exceptions);
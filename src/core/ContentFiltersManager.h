@@ -68,6 +68,7 @@ public:
 	{
 		QStringList rules;
 		QStringList exceptions;
+		CosmeticFiltersMode mode = NoFilters;
 	};
 
 	static void createInstance();
@@ -80,7 +81,7 @@ public:
 	static ContentFiltersProfile* getProfile(const QUrl &url);
 	static ContentFiltersProfile* getProfile(int identifier);
 	static CheckResult checkUrl(const QVector<int> &profiles, const QUrl &baseUrl, const QUrl &requestUrl, NetworkManager::ResourceType resourceType);
-	static CosmeticFiltersResult getCosmeticFilters(const QVector<int> &profiles, const QUrl &requestUrl);
+	static CosmeticFiltersResult getCosmeticFilters(const QVector<int> &profiles, const QUrl &requestUrl, bool isDomainOnly = false);
 	static QStringList createSubdomainList(const QString &domain);
 	static QStringList getProfileNames();
 	static QVector<ContentFiltersProfile*> getContentBlockingProfiles();
@@ -20,7 +20,6 @@
 #include "FeedParser.h"
 #include "Console.h"
 #include "FeedsManager.h"
-#include "Job.h"
 
 #include <QtCore/QCryptographicHash>
 #include <QtCore/QMimeDatabase>
@@ -33,26 +32,33 @@ FeedParser::FeedParser() : QObject()
 {
 }
 
-FeedParser* FeedParser::createParser(Feed *feed, DataFetchJob *data)
+void FeedParser::addMessage(const QString &note, Console::MessageCategory category, const QUrl &url, int line)
 {
-	if (!feed || !data)
-	{
-		return nullptr;
-	}
+	Console::Message message;
+	message.note = note;
+	message.source = url.toDisplayString();
+	message.category = category;
+	message.level = Console::ErrorLevel;
+	message.line = line;
+
+	m_information.messages.append(message);
+}
 
+FeedParser* FeedParser::createParser(const QUrl &url, const QByteArray &data, const QByteArray &contentType)
+{
 	const QMimeDatabase mimeDatabase;
 	const QMap<QString, ParserType> parsers({{QLatin1String("application/atom+xml"), AtomParser}, {QLatin1String("application/rss+xml"), RssParser}});
-	QMimeType mimeType(mimeDatabase.mimeTypeForData(data->getData()));
+	QMimeType mimeType(mimeDatabase.mimeTypeForData(data));
 
 	if (!mimeType.isValid() || !parsers.contains(mimeType.name()))
 	{
-		mimeType = mimeDatabase.mimeTypeForUrl(feed->getUrl());
+		mimeType = mimeDatabase.mimeTypeForUrl(url);
 	}
 
-	if ((!mimeType.isValid() || !parsers.contains(mimeType.name())) && data->getHeaders().contains(QByteArrayLiteral("Content-Type")))
+	if ((!mimeType.isValid() || !parsers.contains(mimeType.name())) && !contentType.isEmpty())
 	{
 		QMap<QString, ParserType>::const_iterator iterator;
-		const QString header(data->getHeaders().value(QByteArrayLiteral("Content-Type")));
+		const QString header(contentType);
 
 		for (iterator = parsers.begin(); iterator != parsers.end(); ++iterator)
 		{
@@ -95,14 +101,47 @@ QString FeedParser::createIdentifier(const Feed::Entry &entry)
 	return QString(hash.result());
 }
 
+FeedParser::FeedInformation FeedParser::parseFeed(const QUrl &url, const QByteArray &data, const QByteArray &contentType)
+{
+	FeedParser *parser(createParser(url, data, contentType));
+
+	if (!parser)
+	{
+		FeedInformation information;
+
+		Console::Message message;
+		message.note = tr("Failed to parse feed: unknown feed format");
+		message.source = url.toDisplayString();
+		message.category = Console::NetworkCategory;
+		message.level = Console::ErrorLevel;
+
+		information.messages.append(message);
+
+		return information;
+	}
+
+	parser->parse(data, url);
+
+	const FeedInformation information(parser->getInformation());
+
+	delete parser;
+
+	return information;
+}
+
+FeedParser::FeedInformation FeedParser::getInformation() const
+{
+	return m_information;
+}
+
 AtomFeedParser::AtomFeedParser() : FeedParser()
 {
 	m_information.mimeType = QMimeDatabase().mimeTypeForName(QLatin1String("application/atom+xml"));
 }
 
-void AtomFeedParser::parse(DataFetchJob *data)
+void AtomFeedParser::parse(const QByteArray &data, const QUrl &url)
 {
-	QXmlStreamReader reader(data->getData());
+	QXmlStreamReader reader(data);
 	bool isSuccess(true);
 
 	m_information.entries.reserve(10);
@@ -221,7 +260,7 @@ void AtomFeedParser::parse(DataFetchJob *data)
 
 			if (reader.hasError())
 			{
-				Console::addMessage(tr("Failed to parse feed file: %1").arg(reader.errorString()), Console::OtherCategory, Console::ErrorLevel, data->getUrl().toDisplayString());
+				addMessage(tr("Failed to parse feed file: %1").arg(reader.errorString()), Console::OtherCategory, url);
 
 				isSuccess = false;
 			}
@@ -232,17 +271,12 @@ void AtomFeedParser::parse(DataFetchJob *data)
 
 	if (m_information.entries.isEmpty())
 	{
-		Console::addMessage(tr("Failed to parse feed: no valid entries found"), Console::NetworkCategory, Console::ErrorLevel, data->getUrl().toDisplayString());
+		addMessage(tr("Failed to parse feed: no valid entries found"), Console::NetworkCategory, url);
 
 		isSuccess = false;
 	}
 
-	emit parsingFinished(isSuccess);
-}
-
-FeedParser::FeedInformation AtomFeedParser::getInformation() const
-{
-	return m_information;
+	m_information.isSuccess = isSuccess;
 }
 
 QDateTime AtomFeedParser::readDateTime(QXmlStreamReader *reader)
@@ -258,9 +292,9 @@ RssFeedParser::RssFeedParser() : FeedParser()
 	m_information.mimeType = QMimeDatabase().mimeTypeForName(QLatin1String("application/rss+xml"));
 }
 
-void RssFeedParser::parse(DataFetchJob *data)
+void RssFeedParser::parse(const QByteArray &data, const QUrl &url)
 {
-	QXmlStreamReader reader(data->getData());
+	QXmlStreamReader reader(data);
 	bool isSuccess(true);
 	QRegularExpression emailExpression(QLatin1String(R"(^[a-zA-Z0-9\._\-]+@[a-zA-Z0-9\._\-]+\.[a-zA-Z0-9]+$)"));
 	emailExpression.optimize();
@@ -384,7 +418,7 @@ void RssFeedParser::parse(DataFetchJob *data)
 
 			if (reader.hasError())
 			{
-				Console::addMessage(tr("Failed to parse feed file: %1").arg(reader.errorString()), Console::OtherCategory, Console::ErrorLevel, data->getUrl().toDisplayString(), static_cast<int>(reader.lineNumber()));
+				addMessage(tr("Failed to parse feed file: %1").arg(reader.errorString()), Console::OtherCategory, url, static_cast<int>(reader.lineNumber()));
 
 				isSuccess = false;
 			}
@@ -395,17 +429,12 @@ void RssFeedParser::parse(DataFetchJob *data)
 
 	if (m_information.entries.isEmpty())
 	{
-		Console::addMessage(tr("Failed to parse feed: no valid entries found"), Console::NetworkCategory, Console::ErrorLevel, data->getUrl().toDisplayString());
+		addMessage(tr("Failed to parse feed: no valid entries found"), Console::NetworkCategory, url);
 
 		isSuccess = false;
 	}
 
-	emit parsingFinished(isSuccess);
-}
-
-FeedParser::FeedInformation RssFeedParser::getInformation() const
-{
-	return m_information;
+	m_information.isSuccess = isSuccess;
 }
 
 QDateTime RssFeedParser::readDateTime(QXmlStreamReader *reader)
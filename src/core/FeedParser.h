@@ -20,6 +20,7 @@
 #ifndef OTTER_FEEDPARSER_H
 #define OTTER_FEEDPARSER_H
 
+#include "Console.h"
 #include "FeedsManager.h"
 
 #include <QtCore/QMimeType>
@@ -28,8 +29,6 @@
 namespace Otter
 {
 
-class DataFetchJob;
-
 class FeedParser : public QObject
 {
 	Q_OBJECT
@@ -51,19 +50,22 @@ public:
 		QMimeType mimeType;
 		QMap<QString, QString> categories;
 		QVector<Feed::Entry> entries;
+		QVector<Console::Message> messages;
+		bool isSuccess = false;
 	};
 
 	explicit FeedParser();
 
-	virtual void parse(DataFetchJob *data) = 0;
-	virtual FeedInformation getInformation() const = 0;
-	static FeedParser* createParser(Feed *feed, DataFetchJob *data);
+	virtual void parse(const QByteArray &data, const QUrl &url) = 0;
+	static FeedInformation parseFeed(const QUrl &url, const QByteArray &data, const QByteArray &contentType);
+	FeedInformation getInformation() const;
 
 protected:
+	void addMessage(const QString &note, Console::MessageCategory category, const QUrl &url, int line = -1);
+	static FeedParser* createParser(const QUrl &url, const QByteArray &data, const QByteArray &contentType);
 	static QString createIdentifier(const Feed::Entry &entry);
 
-signals:
-	void parsingFinished(bool isSuccess);
+	FeedInformation m_information;
 };
 
 class AtomFeedParser final : public FeedParser
@@ -71,14 +73,10 @@ class AtomFeedParser final : public FeedParser
 public:
 	explicit AtomFeedParser();
 
-	void parse(DataFetchJob *data) override;
-	FeedInformation getInformation() const override;
+	void parse(const QByteArray &data, const QUrl &url) override;
 
 protected:
 	QDateTime readDateTime(QXmlStreamReader *reader);
-
-private:
-	FeedInformation m_information;
 };
 
 class RssFeedParser final : public FeedParser
@@ -86,14 +84,10 @@ class RssFeedParser final : public FeedParser
 public:
 	explicit RssFeedParser();
 
-	void parse(DataFetchJob *data) override;
-	FeedInformation getInformation() const override;
+	void parse(const QByteArray &data, const QUrl &url) override;
 
 protected:
 	QDateTime readDateTime(QXmlStreamReader *reader);
-
-private:
-	FeedInformation m_information;
 };
 
 }
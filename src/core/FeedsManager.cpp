@@ -29,17 +29,18 @@
 #include "Utils.h"
 
 #include <QtCore/QFile>
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QSaveFile>
+#include <QtConcurrent/QtConcurrentRun>
 
 namespace Otter
 {
 
 Feed::Feed(const QString &title, const QUrl &url, const QIcon &icon, int updateInterval, QObject *parent) : QObject(parent),
 	m_updateTimer(nullptr),
-	m_parser(nullptr),
 	m_title(title),
 	m_url(url),
 	m_icon(icon),
@@ -179,7 +180,7 @@ void Feed::setUpdateInterval(int interval)
 
 void Feed::update()
 {
-	if (m_parser)
+	if (m_isUpdating)
 	{
 		return;
 	}
@@ -199,165 +200,183 @@ void Feed::update()
 	});
 	connect(dataJob, &DataFetchJob::jobFinished, this, [=](bool isFetchSuccess)
 	{
-		if (isFetchSuccess)
+		if (!isFetchSuccess)
 		{
-			m_parser = FeedParser::createParser(this, dataJob);
+			m_error = DownloadError;
+			m_isUpdating = false;
 
-			if (m_parser)
-			{
-				m_parser->moveToThread(&m_parserThread);
+			Console::addMessage(tr("Failed to download feed"), Console::NetworkCategory, Console::ErrorLevel, m_url.toDisplayString());
 
-				connect(m_parser, &FeedParser::parsingFinished, [&](bool isParsingSuccess)
-				{
-					const FeedParser::FeedInformation information(m_parser->getInformation());
+			emit feedModified(this);
 
-					if (!isParsingSuccess)
-					{
-						m_error = ParseError;
-					}
+			return;
+		}
 
-					if (m_icon.isNull() && information.icon.isValid())
-					{
-						IconFetchJob *iconJob(new IconFetchJob(information.icon, this));
+		const QUrl url(m_url);
+		const QByteArray data(dataJob->getData()->readAll());
+		const QByteArray contentType(dataJob->getHeaders().value(QByteArrayLiteral("Content-Type")));
+		QFutureWatcher<FeedParser::FeedInformation> *watcher(new QFutureWatcher<FeedParser::FeedInformation>(this));
 
-						connect(iconJob, &IconFetchJob::jobFinished, this, [=]()
-						{
-							setIcon(iconJob->getIcon());
-						});
+		connect(watcher, &QFutureWatcher<FeedParser::FeedInformation>::finished, this, [=]()
+		{
+			const FeedParser::FeedInformation information(watcher->result());
 
-						iconJob->start();
-					}
+			watcher->deleteLater();
 
-					if (m_title.isEmpty())
-					{
-						m_title = information.title;
-					}
+			for (int i = 0; i < information.messages.count(); ++i)
+			{
+				const Console::Message message(information.messages.at(i));
 
-					if (m_description.isEmpty())
-					{
-						m_description = information.description;
-					}
+				Console::addMessage(message.note, message.category, message.level, message.source, message.line);
+			}
 
-					if (!information.entries.isEmpty())
-					{
-						QStringList existingRemovedEntries;
-						int amount(0);
+			if (!information.mimeType.isValid())
+			{
+				m_error = ParseError;
+				m_isUpdating = false;
 
-						for (int i = (information.entries.count() - 1); i >= 0; --i)
-						{
-							Feed::Entry entry(information.entries.at(i));
+				emit feedModified(this);
+
+				return;
+			}
+
+			if (!information.isSuccess)
+			{
+				m_error = ParseError;
+			}
+
+			if (m_icon.isNull() && information.icon.isValid())
+			{
+				IconFetchJob *iconJob(new IconFetchJob(information.icon, this));
+
+				connect(iconJob, &IconFetchJob::jobFinished, this, [=]()
+				{
+					setIcon(iconJob->getIcon());
+				});
 
-							if (m_removedEntries.contains(entry.identifier))
-							{
-								existingRemovedEntries.append(entry.identifier);
-							}
-							else
-							{
-								bool hasEntry(false);
+				iconJob->start();
+			}
 
-								for (int j = 0; j < m_entries.count(); ++j)
-								{
-									const Feed::Entry existingEntry(m_entries.at(j));
+			if (m_title.isEmpty())
+			{
+				m_title = information.title;
+			}
 
-									if (existingEntry.identifier == entry.identifier)
-									{
-										if ((entry.publicationTime.isValid() && existingEntry.publicationTime != entry.publicationTime) || (entry.updateTime.isValid() && existingEntry.updateTime != entry.updateTime))
-										{
-											++amount;
-										}
+			if (m_description.isEmpty())
+			{
+				m_description = information.description;
+			}
 
-										entry.publicationTime = normalizeTime(entry.publicationTime);
+			if (!information.entries.isEmpty())
+			{
+				QHash<QString, int> existingEntries;
+				existingEntries.reserve(m_entries.count());
 
-										if (entry.updateTime.isValid())
-										{
-											entry.updateTime = normalizeTime(entry.updateTime);
-										}
+				for (int i = 0; i < m_entries.count(); ++i)
+				{
+					existingEntries.insert(m_entries.at(i).identifier, i);
+				}
 
-										m_entries[j] = entry;
+				QSet<QString> removedEntries;
+				removedEntries.reserve(m_removedEntries.count());
 
-										hasEntry = true;
+				for (int i = 0; i < m_removedEntries.count(); ++i)
+				{
+					removedEntries.insert(m_removedEntries.at(i));
+				}
 
-										break;
-									}
-								}
+				QVector<Entry> addedEntries;
+				QSet<QString> addedIdentifiers;
+				QStringList existingRemovedEntries;
+				int amount(0);
 
-								if (!hasEntry)
-								{
-									++amount;
+				for (int i = 0; i < information.entries.count(); ++i)
+				{
+					Feed::Entry entry(information.entries.at(i));
 
-									entry.publicationTime = normalizeTime(entry.publicationTime);
-									entry.updateTime = normalizeTime(entry.updateTime);
+					if (removedEntries.contains(entry.identifier))
+					{
+						existingRemovedEntries.append(entry.identifier);
+					}
+					else if (existingEntries.contains(entry.identifier))
+					{
+						const int index(existingEntries.value(entry.identifier));
+						const Feed::Entry &existingEntry(m_entries.at(index));
 
-									m_entries.prepend(entry);
-								}
-							}
+						if ((entry.publicationTime.isValid() && existingEntry.publicationTime != entry.publicationTime) || (entry.updateTime.isValid() && existingEntry.updateTime != entry.updateTime))
+						{
+							++amount;
 						}
 
-						m_removedEntries = existingRemovedEntries;
+						entry.publicationTime = normalizeTime(entry.publicationTime);
 
-						if (amount > 0)
+						if (entry.updateTime.isValid())
 						{
-							Notification::Message message;
-							message.message = getTitle() + QLatin1Char('\n') + tr("%n new message(s)", nullptr, amount);
-							message.icon = getIcon();
-							message.event = NotificationsManager::FeedUpdatedEvent;
-
-							if (message.icon.isNull())
-							{
-								message.icon = ThemesManager::createIcon(QLatin1String("application-rss+xml"));
-							}
-
-							connect(NotificationsManager::createNotification(message, this), &Notification::clicked, [&]()
-							{
-								Application::getInstance()->triggerAction(ActionsManager::OpenUrlAction, {{QLatin1String("url"), FeedsManager::createFeedReaderUrl(getUrl())}});
-							});
+							entry.updateTime = normalizeTime(entry.updateTime);
 						}
 
-						emit entriesModified(this);
+						m_entries[index] = entry;
 					}
+					else if (!addedIdentifiers.contains(entry.identifier))
+					{
+						++amount;
 
-					m_mimeType = information.mimeType;
-					m_lastSynchronizationTime = QDateTime::currentDateTimeUtc();
-					m_lastUpdateTime = information.lastUpdateTime;
-					m_categories = information.categories;
+						entry.publicationTime = normalizeTime(entry.publicationTime);
+						entry.updateTime = normalizeTime(entry.updateTime);
 
-					m_parserThread.exit();
+						addedEntries.append(entry);
+						addedIdentifiers.insert(entry.identifier);
+					}
+				}
 
-					m_parser->deleteLater();
-					m_parser = nullptr;
+				if (!addedEntries.isEmpty())
+				{
+					addedEntries.reserve(addedEntries.count() + m_entries.count());
+					addedEntries.append(m_entries);
 
-					m_isUpdating = false;
+					m_entries = addedEntries;
+				}
 
-					emit feedModified(this);
-				});
+				m_removedEntries = existingRemovedEntries;
 
-				m_parserThread.start();
+				if (amount > 0)
+				{
+					Notification::Message message;
+					message.message = getTitle() + QLatin1Char('\n') + tr("%n new message(s)", nullptr, amount);
+					message.icon = getIcon();
+					message.event = NotificationsManager::FeedUpdatedEvent;
 
-				m_parser->parse(dataJob);
+					if (message.icon.isNull())
+					{
+						message.icon = ThemesManager::createIcon(QLatin1String("application-rss+xml"));
+					}
 
-				m_updateProgress = -1;
+					connect(NotificationsManager::createNotification(message, this), &Notification::clicked, [&]()
+					{
+						Application::getInstance()->triggerAction(ActionsManager::OpenUrlAction, {{QLatin1String("url"), FeedsManager::createFeedReaderUrl(getUrl())}});
+					});
+				}
 
-				emit updateProgressChanged(-1);
+				emit entriesModified(this);
 			}
-			else
-			{
-				m_error = ParseError;
-				m_isUpdating = false;
 
-				Console::addMessage(tr("Failed to parse feed: unknown feed format"), Console::NetworkCategory, Console::ErrorLevel, m_url.toDisplayString());
+			m_mimeType = information.mimeType;
+			m_lastSynchronizationTime = QDateTime::currentDateTimeUtc();
+			m_lastUpdateTime = information.lastUpdateTime;
+			m_categories = information.categories;
+			m_isUpdating = false;
 
-				emit feedModified(this);
-			}
-		}
-		else
+			emit feedModified(this);
+		});
+
+		watcher->setFuture(QtConcurrent::run(FeedsManager::getThreadPool(), [=]()
 		{
-			m_error = DownloadError;
-			m_isUpdating = false;
+			return FeedParser::parseFeed(url, data, contentType);
+		}));
 
-			Console::addMessage(tr("Failed to download feed"), Console::NetworkCategory, Console::ErrorLevel, m_url.toDisplayString());
+		m_updateProgress = -1;
 
-			emit feedModified(this);
-		}
+		emit updateProgressChanged(-1);
 	});
 
 	dataJob->start();
@@ -485,17 +504,36 @@ bool Feed::isUpdating() const
 
 FeedsManager* FeedsManager::m_instance(nullptr);
 FeedsModel* FeedsManager::m_model(nullptr);
+QThreadPool* FeedsManager::m_threadPool(nullptr);
 QVector<Feed*> FeedsManager::m_feeds;
 bool FeedsManager::m_isInitialized(false);
 
 FeedsManager::FeedsManager(QObject *parent) : QObject(parent),
-	m_saveTimer(0)
+	m_saveTimer(0),
+	m_updateTimer(0)
 {
 }
 
 void FeedsManager::timerEvent(QTimerEvent *event)
 {
-	if (event->timerId() == m_saveTimer)
+	if (event->timerId() == m_updateTimer)
+	{
+		killTimer(m_updateTimer);
+
+		m_updateTimer = 0;
+
+		const QSet<Feed*> feeds(m_modifiedFeeds);
+
+		m_modifiedFeeds.clear();
+
+		QSet<Feed*>::const_iterator iterator;
+
+		for (iterator = feeds.begin(); iterator != feeds.end(); ++iterator)
+		{
+			emit feedModified((*iterator)->getUrl());
+		}
+	}
+	else if (event->timerId() == m_saveTimer)
 	{
 		killTimer(m_saveTimer);
 
@@ -722,7 +760,12 @@ void FeedsManager::handleFeedModified(Feed *feed)
 {
 	if (feed)
 	{
-		emit feedModified(feed->getUrl());
+		m_modifiedFeeds.insert(feed);
+
+		if (m_updateTimer == 0)
+		{
+			m_updateTimer = startTimer(100);
+		}
 	}
 
 	scheduleSave();
@@ -784,6 +827,18 @@ QUrl FeedsManager::createFeedReaderUrl(const QUrl &url)
 	return QUrl(QLatin1String("view-feed:") + url.toDisplayString());
 }
 
+QThreadPool* FeedsManager::getThreadPool()
+{
+	if (!m_threadPool)
+	{
+		m_threadPool = new QThreadPool(m_instance);
+		m_threadPool->setMaxThreadCount(qBound(1, QThread::idealThreadCount(), 4));
+		m_threadPool->setExpiryTimeout(60000);
+	}
+
+	return m_threadPool;
+}
+
 QVector<Feed*> FeedsManager::getFeeds()
 {
 	ensureInitialized();
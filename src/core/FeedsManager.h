@@ -24,13 +24,12 @@
 
 #include <QtCore/QDateTime>
 #include <QtCore/QMimeType>
-#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
 
 namespace Otter
 {
 
 class FeedsManager;
-class FeedParser;
 class LongTermTimer;
 
 class Feed final : public QObject
@@ -98,8 +97,6 @@ protected:
 
 private:
 	LongTermTimer *m_updateTimer;
-	FeedParser *m_parser;
-	QThread m_parserThread;
 	QString m_title;
 	QString m_description;
 	QUrl m_url;
@@ -134,6 +131,7 @@ public:
 	static Feed* createFeed(const QUrl &url, const QString &title = {}, const QIcon &icon = {}, int updateInterval = -1);
 	static Feed* getFeed(const QUrl &url);
 	static QUrl createFeedReaderUrl(const QUrl &url);
+	static QThreadPool* getThreadPool();
 	static QVector<Feed*> getFeeds();
 
 protected:
@@ -147,10 +145,13 @@ protected slots:
 	void handleFeedModified(Feed *feed);
 
 private:
+	QSet<Feed*> m_modifiedFeeds;
 	int m_saveTimer;
+	int m_updateTimer;
 
 	static FeedsManager *m_instance;
 	static FeedsModel *m_model;
+	static QThreadPool *m_threadPool;
 	static QVector<Feed*> m_feeds;
 	static bool m_isInitialized;
 
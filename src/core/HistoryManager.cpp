@@ -21,12 +21,15 @@
 #include "HistoryManager.h"
 #include "AddonsManager.h"
 #include "Application.h"
+#include "BookmarksManager.h"
 #include "SessionsManager.h"
 #include "SettingsManager.h"
 #include "ThemesManager.h"
 
 #include <QtCore/QTimerEvent>
 
+#include <algorithm>
+
 namespace Otter
 {
 
@@ -325,7 +328,7 @@ HistoryModel::Entry* HistoryManager::getEntry(quint64 identifier)
 	return m_browsingHistoryModel->getEntry(identifier);
 }
 
-QVector<HistoryModel::HistoryEntryMatch> HistoryManager::findEntries(const QString &prefix, bool isTypedInOnly)
+QVector<HistoryModel::HistoryEntryMatch> HistoryManager::findEntries(const QString &prefix, bool isTypedInOnly, int limit)
 {
 	if (!m_typedHistoryModel)
 	{
@@ -339,9 +342,66 @@ QVector<HistoryModel::HistoryEntryMatch> HistoryManager::findEntries(const QStri
 
 	QVector<HistoryModel::HistoryEntryMatch> entries(m_typedHistoryModel->findEntries(prefix, true));
 
+	for (int i = 0; i < entries.count(); ++i)
+	{
+		entries[i].score *= 2;
+	}
+
 	if (!isTypedInOnly)
 	{
-		entries.append(m_browsingHistoryModel->findEntries(prefix));
+		const QVector<HistoryModel::HistoryEntryMatch> browsingEntries(m_browsingHistoryModel->findEntries(prefix));
+		QHash<QUrl, int> typedEntries;
+		typedEntries.reserve(entries.count());
+
+		for (int i = 0; i < entries.count(); ++i)
+		{
+			typedEntries[Utils::normalizeUrl(entries.at(i).entry->getUrl())] = i;
+		}
+
+		entries.reserve(entries.count() + browsingEntries.count());
+
+		for (int i = 0; i < browsingEntries.count(); ++i)
+		{
+			const int typedEntry(typedEntries.isEmpty() ? -1 : typedEntries.value(Utils::normalizeUrl(browsingEntries.at(i).entry->getUrl()), -1));
+
+			if (typedEntry >= 0)
+			{
+				entries[typedEntry].score += browsingEntries.at(i).score;
+			}
+			else
+			{
+				entries.append(browsingEntries.at(i));
+			}
+		}
+
+		for (int i = 0; i < entries.count(); ++i)
+		{
+			if (BookmarksManager::hasBookmark(entries.at(i).entry->getUrl()))
+			{
+				entries[i].score *= 1.5;
+			}
+		}
+	}
+
+	const auto compareEntries([](const HistoryModel::HistoryEntryMatch &first, const HistoryModel::HistoryEntryMatch &second)
+	{
+		if (first.score != second.score)
+		{
+			return (first.score > second.score);
+		}
+
+		return (first.entry->getTimeVisited() > second.entry->getTimeVisited());
+	});
+
+	if (limit > 0 && entries.count() > limit)
+	{
+		std::partial_sort(entries.begin(), (entries.begin() + limit), entries.end(), compareEntries);
+
+		entries.resize(limit);
+	}
+	else
+	{
+		std::sort(entries.begin(), entries.end(), compareEntries);
 	}
 
 	return entries;
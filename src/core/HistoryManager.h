@@ -44,7 +44,7 @@ public:
 	static HistoryModel* getTypedHistoryModel();
 	static QIcon getIcon(const QUrl &url);
 	static HistoryModel::Entry* getEntry(quint64 identifier);
-	static QVector<HistoryModel::HistoryEntryMatch> findEntries(const QString &prefix, bool isTypedInOnly = false);
+	static QVector<HistoryModel::HistoryEntryMatch> findEntries(const QString &prefix, bool isTypedInOnly = false, int limit = 0);
 	static quint64 addEntry(const QUrl &url, const QString &title, const QIcon &icon, bool isTypedIn = false);
 	static bool hasEntry(const QUrl &url);
 
@@ -28,10 +28,13 @@
 #include <QtCore/QFile>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
+#include <QtCore/QtMath>
 
 namespace Otter
 {
 
+qint64 HistoryModel::m_frecencyEpoch(QDateTime::currentMSecsSinceEpoch() / 1000);
+
 HistoryModel::Entry::Entry() : QStandardItem()
 {
 }
@@ -126,6 +129,8 @@ void HistoryModel::clearRecentEntries(uint period)
 	{
 		clear();
 
+		m_frecencies.clear();
+
 		emit cleared();
 
 		return;
@@ -169,6 +174,8 @@ void HistoryModel::removeEntry(quint64 identifier)
 
 	const QUrl url(Utils::normalizeUrl(entry->getUrl()));
 
+	updateFrecency(url, entry->getTimeVisited(), false);
+
 	if (m_urls.contains(url))
 	{
 		m_urls[url].removeAll(entry);
@@ -176,6 +183,7 @@ void HistoryModel::removeEntry(quint64 identifier)
 		if (m_urls[url].isEmpty())
 		{
 			m_urls.remove(url);
+			m_frecencies.remove(url);
 		}
 	}
 
@@ -242,17 +250,34 @@ HistoryModel::Entry* HistoryModel::getEntry(quint64 identifier) const
 	return nullptr;
 }
 
+void HistoryModel::updateFrecency(const QUrl &url, const QDateTime &dateTime, bool isAdding)
+{
+	if (url.isEmpty() || !dateTime.isValid())
+	{
+		return;
+	}
+
+	const qreal visitFrecency(qPow(2, (static_cast<qreal>((dateTime.toMSecsSinceEpoch() / 1000) - m_frecencyEpoch) / 2592000)));
+	const qreal frecency(m_frecencies.value(url) + (isAdding ? visitFrecency : -visitFrecency));
+
+	if (frecency > 0)
+	{
+		m_frecencies[url] = frecency;
+	}
+	else
+	{
+		m_frecencies.remove(url);
+	}
+}
+
 QVector<HistoryModel::HistoryEntryMatch> HistoryModel::findEntries(const QString &prefix, bool markAsTypedIn) const
 {
-	QVector<Entry*> matchedEntries;
-	QVector<HistoryEntryMatch> allMatches;
-	QVector<HistoryEntryMatch> currentMatches;
-	QMultiMap<QDateTime, HistoryEntryMatch> matchesMap;
+	QVector<HistoryEntryMatch> matches;
 	QHash<QUrl, QVector<Entry*> >::const_iterator urlsIterator;
 
 	for (urlsIterator = m_urls.constBegin(); urlsIterator != m_urls.constEnd(); ++urlsIterator)
 	{
-		if (urlsIterator.value().isEmpty() || matchedEntries.contains(urlsIterator.value().first()))
+		if (urlsIterator.value().isEmpty())
 		{
 			continue;
 		}
@@ -264,28 +289,14 @@ QVector<HistoryModel::HistoryEntryMatch> HistoryModel::findEntries(const QString
 			HistoryEntryMatch match;
 			match.entry = urlsIterator.value().first();
 			match.match = result;
+			match.score = m_frecencies.value(urlsIterator.key());
+			match.isTypedIn = markAsTypedIn;
 
-			if (markAsTypedIn)
-			{
-				match.isTypedIn = true;
-			}
-
-			matchesMap.insert(match.entry->data(TimeVisitedRole).toDateTime(), match);
-
-			matchedEntries.append(match.entry);
+			matches.append(match);
 		}
 	}
 
-	currentMatches = matchesMap.values().toVector();
-
-	matchesMap.clear();
-
-	for (int i = (currentMatches.count() - 1); i >= 0; --i)
-	{
-		allMatches.append(currentMatches.at(i));
-	}
-
-	return allMatches;
+	return matches;
 }
 
 HistoryModel::HistoryType HistoryModel::getType() const
@@ -327,6 +338,13 @@ bool HistoryModel::setData(const QModelIndex &index, const QVariant &value, int
 		return QStandardItemModel::setData(index, value, role);
 	}
 
+	const bool isChangingFrecency((role == UrlRole && value.toUrl() != index.data(UrlRole).toUrl()) || (role == TimeVisitedRole && value.toDateTime() != index.data(TimeVisitedRole).toDateTime()));
+
+	if (isChangingFrecency)
+	{
+		updateFrecency(Utils::normalizeUrl(entry->getUrl()), entry->getTimeVisited(), false);
+	}
+
 	if (role == UrlRole && value.toUrl() != index.data(UrlRole).toUrl())
 	{
 		const QUrl oldUrl(Utils::normalizeUrl(index.data(UrlRole).toUrl()));
@@ -339,6 +357,7 @@ bool HistoryModel::setData(const QModelIndex &index, const QVariant &value, int
 			if (m_urls[oldUrl].isEmpty())
 			{
 				m_urls.remove(oldUrl);
+				m_frecencies.remove(oldUrl);
 			}
 		}
 
@@ -355,6 +374,11 @@ bool HistoryModel::setData(const QModelIndex &index, const QVariant &value, int
 
 	entry->setItemData(value, role);
 
+	if (isChangingFrecency)
+	{
+		updateFrecency(Utils::normalizeUrl(entry->getUrl()), entry->getTimeVisited(), true);
+	}
+
 	switch (role)
 	{
 		case TitleRole:
@@ -68,6 +68,7 @@ public:
 	{
 		Entry *entry = nullptr;
 		QString match;
+		qreal score = 0;
 		bool isTypedIn = false;
 	};
 
@@ -85,11 +86,17 @@ public:
 	bool save(const QString &path) const;
 	bool setData(const QModelIndex &index, const QVariant &value, int role) override;
 
+protected:
+	void updateFrecency(const QUrl &url, const QDateTime &dateTime, bool isAdding);
+
 private:
 	QHash<QUrl, QVector<Entry*> > m_urls;
+	QHash<QUrl, qreal> m_frecencies;
 	QMap<quint64, Entry*> m_identifiers;
 	HistoryType m_type;
 
+	static qint64 m_frecencyEpoch;
+
 signals:
 	void cleared();
 	void entryAdded(Entry *entry);
@@ -24,20 +24,110 @@
 #include "SettingsManager.h"
 #include "Utils.h"
 
-#include <QtCore/QEventLoop>
+#include <QtCore/QDateTime>
 #include <QtCore/QFileInfo>
 #include <QtCore/QRegularExpression>
-#include <QtCore/QTimer>
+#include <QtCore/QTimerEvent>
 #include <QtNetwork/QHostInfo>
 
 namespace Otter
 {
 
-InputInterpreter::InputInterpreter(QObject *parent) : QObject(parent)
+QCache<QString, InputInterpreter::HostLookup> InputInterpreter::m_hostLookups(1000);
+
+InputInterpreter::InputInterpreter(QObject *parent) : QObject(parent),
+	m_lookupIdentifier(-1),
+	m_lookupTimer(0)
+{
+}
+
+void InputInterpreter::timerEvent(QTimerEvent *event)
+{
+	if (event->timerId() == m_lookupTimer)
+	{
+		const InterpreterResult result(m_result);
+
+		cancel();
+
+		emit finished(result);
+	}
+}
+
+void InputInterpreter::start(const QString &text, InterpreterFlags flags)
+{
+	cancel();
+
+	QString host;
+	const InterpreterResult result(createResult(text, flags, &host));
+
+	if (host.isEmpty())
+	{
+		emit finished(result);
+
+		return;
+	}
+
+#if QT_VERSION >= 0x050900
+	m_result = result;
+	m_text = text;
+	m_lookupIdentifier = QHostInfo::lookupHost(host, this, [=](const QHostInfo &information)
+	{
+		if (information.lookupId() != m_lookupIdentifier)
+		{
+			return;
+		}
+
+		HostLookup *hostLookup(new HostLookup());
+		hostLookup->time = QDateTime::currentMSecsSinceEpoch();
+		hostLookup->isValid = (information.error() == QHostInfo::NoError);
+
+		m_hostLookups.insert(host, hostLookup);
+
+		InterpreterResult lookupResult(m_result);
+
+		if (hostLookup->isValid)
+		{
+			lookupResult = {};
+			lookupResult.url = QUrl::fromUserInput(m_text);
+			lookupResult.type = InterpreterResult::UrlType;
+		}
+
+		m_lookupIdentifier = -1;
+
+		cancel();
+
+		emit finished(lookupResult);
+	});
+	m_lookupTimer = startTimer(SettingsManager::getOption(SettingsManager::AddressField_HostLookupTimeoutOption).toInt());
+#endif
+}
+
+void InputInterpreter::cancel()
 {
+	if (m_lookupIdentifier >= 0)
+	{
+		QHostInfo::abortHostLookup(m_lookupIdentifier);
+
+		m_lookupIdentifier = -1;
+	}
+
+	if (m_lookupTimer != 0)
+	{
+		killTimer(m_lookupTimer);
+
+		m_lookupTimer = 0;
+	}
+
+	m_result = {};
+	m_text.clear();
 }
 
 InputInterpreter::InterpreterResult InputInterpreter::interpret(const QString &text, InterpreterFlags flags)
+{
+	return createResult(text, flags, nullptr);
+}
+
+InputInterpreter::InterpreterResult InputInterpreter::createResult(const QString &text, InterpreterFlags flags, QString *host)
 {
 	InterpreterResult result;
 
@@ -107,7 +197,7 @@ InputInterpreter::InterpreterResult InputInterpreter::interpret(const QString &t
 
 	const QFileInfo fileInformation(text);
 
-	if (fileInformation.exists() && fileInformation.isAbsolute())
+	if (fileInformation.isAbsolute() && fileInformation.exists())
 	{
 		result.url = QUrl::fromLocalFile(fileInformation.canonicalFilePath());
 		result.type = InterpreterResult::UrlType;
@@ -126,45 +216,21 @@ InputInterpreter::InterpreterResult InputInterpreter::interpret(const QString &t
 	}
 
 #if QT_VERSION >= 0x050900
-	if (!flags.testFlag(NoHostLookupFlag))
+	if (!flags.testFlag(NoHostLookupFlag) && url.isValid() && SettingsManager::getOption(SettingsManager::AddressField_HostLookupTimeoutOption).toInt() > 0)
 	{
-		const int lookupTimeout(SettingsManager::getOption(SettingsManager::AddressField_HostLookupTimeoutOption).toInt());
+		const HostLookup *hostLookup(getHostLookup(url.host()));
 
-		if (url.isValid() && lookupTimeout > 0)
+		if (hostLookup && hostLookup->isValid)
 		{
-			QEventLoop eventLoop;
-			const int lookupIdentifier(QHostInfo::lookupHost(url.host(), [&](const QHostInfo &information)
-			{
-				if (information.error() == QHostInfo::NoError)
-				{
-					result.url = QUrl::fromUserInput(text);
-					result.type = InterpreterResult::UrlType;
-				}
-
-				eventLoop.quit();
-			}));
-
-			QTimer timer;
-			timer.setSingleShot(true);
-
-			connect(&timer, &QTimer::timeout, [&]()
-			{
-				QHostInfo::abortHostLookup(lookupIdentifier);
-
-				eventLoop.quit();
-			});
-
-			timer.start(lookupTimeout);
-
-			if (result.type == InterpreterResult::UnknownType)
-			{
-				eventLoop.exec();
-			}
-
-			if (result.type == InterpreterResult::UrlType)
-			{
-				return result;
-			}
+			result.url = url;
+			result.type = InterpreterResult::UrlType;
+
+			return result;
+		}
+
+		if (!hostLookup && host)
+		{
+			*host = url.host();
 		}
 	}
 #endif
@@ -175,4 +241,18 @@ InputInterpreter::InterpreterResult InputInterpreter::interpret(const QString &t
 	return result;
 }
 
+const InputInterpreter::HostLookup* InputInterpreter::getHostLookup(const QString &host)
+{
+	const HostLookup *hostLookup(m_hostLookups.object(host));
+
+	if (hostLookup && (QDateTime::currentMSecsSinceEpoch() - hostLookup->time) > (hostLookup->isValid ? 300000 : 60000))
+	{
+		m_hostLookups.remove(host);
+
+		return nullptr;
+	}
+
+	return hostLookup;
+}
+
 }
@@ -23,6 +23,8 @@
 
 #include "BookmarksModel.h"
 
+#include <QtCore/QCache>
+
 namespace Otter
 {
 
@@ -65,7 +67,33 @@ public:
 
 	explicit InputInterpreter(QObject *parent = nullptr);
 
+	void start(const QString &text, InterpreterFlags flags = NoFlags);
 	static InterpreterResult interpret(const QString &text, InterpreterFlags flags = NoFlags);
+
+public slots:
+	void cancel();
+
+protected:
+	struct HostLookup final
+	{
+		qint64 time = 0;
+		bool isValid = false;
+	};
+
+	void timerEvent(QTimerEvent *event) override;
+	static InterpreterResult createResult(const QString &text, InterpreterFlags flags, QString *host);
+	static const HostLookup* getHostLookup(const QString &host);
+
+private:
+	InterpreterResult m_result;
+	QString m_text;
+	int m_lookupIdentifier;
+	int m_lookupTimer;
+
+	static QCache<QString, HostLookup> m_hostLookups;
+
+signals:
+	void finished(const InputInterpreter::InterpreterResult &result);
 };
 
 }
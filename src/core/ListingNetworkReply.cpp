@@ -20,10 +20,10 @@
 #include "ListingNetworkReply.h"
 #include "Application.h"
 #include "SessionsManager.h"
+#include "SettingsManager.h"
 #include "ThemesManager.h"
 #include "Utils.h"
 
-#include <QtCore/QBuffer>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QtMath>
 #include <QtWidgets/QFileIconProvider>
@@ -31,12 +31,20 @@
 namespace Otter
 {
 
+QString ListingNetworkReply::m_iconDataUrisKey;
+QHash<QString, QString> ListingNetworkReply::m_iconDataUris;
+
 ListingNetworkReply::ListingNetworkReply(const QNetworkRequest &request, QObject *parent) : QNetworkReply(parent)
 {
 	setRequest(request);
 }
 
 QByteArray ListingNetworkReply::createListing(const QString &title, const QVector<ListingNetworkReply::NavigationEntry> &navigation, const QVector<ListingNetworkReply::ListingEntry> &entries)
+{
+	return (createListingHeader(title, navigation) + createListingEntries(entries) + createListingFooter());
+}
+
+QByteArray ListingNetworkReply::createListingHeader(const QString &title, const QVector<ListingNetworkReply::NavigationEntry> &navigation)
 {
 	const QRegularExpression entryExpression(QLatin1String("<!--entry:begin-->(.*)<!--entry:end-->"), (QRegularExpression::DotMatchesEverythingOption | QRegularExpression::MultilineOption));
 	QFile file(SessionsManager::getReadableDataPath(QLatin1String("files/listing.html")));
@@ -45,70 +53,104 @@ QByteArray ListingNetworkReply::createListing(const QString &title, const QVecto
 	QTextStream stream(&file);
 	stream.setCodec("UTF-8");
 
+	const QString listingTemplate(stream.readAll());
+	const QRegularExpressionMatch match(entryExpression.match(listingTemplate));
 	QString navigationHtml;
-	QString entriesHtml;
-	QString listingTemplate(stream.readAll());
-	const QString entryTemplate(entryExpression.match(listingTemplate).captured(1));
-
-	listingTemplate.replace(entryExpression, QLatin1String("{entries}"));
 
 	for (int i = 0; i < navigation.count(); ++i)
 	{
 		navigationHtml.append(QStringLiteral("<a href=\"%1\">%2</a>").arg(navigation[i].url.toString(), navigation[i].name) + ((i < (navigation.count() - 1)) ? QLatin1String("&shy;") : QString()));
 	}
 
-	QHash<QString, QIcon> icons;
+	QHash<QString, QString> variables;
+	variables[QLatin1String("title")] = title.toHtmlEscaped();
+	variables[QLatin1String("description")] = tr("Directory Contents").toHtmlEscaped();
+	variables[QLatin1String("dir")] = (Application::isLeftToRight() ? QLatin1String("ltr") : QLatin1String("rtl"));
+	variables[QLatin1String("style")] = QString();
+	variables[QLatin1String("navigation")] = navigationHtml;
+	variables[QLatin1String("headerName")] = tr("Name").toHtmlEscaped();
+	variables[QLatin1String("headerType")] = tr("Type").toHtmlEscaped();
+	variables[QLatin1String("headerSize")] = tr("Size").toHtmlEscaped();
+	variables[QLatin1String("headerDate")] = tr("Date").toHtmlEscaped();
+
+	m_entryTemplate = match.captured(1);
+	m_footer = Utils::substitutePlaceholders(listingTemplate.mid(match.capturedEnd()), variables);
+
+	return Utils::substitutePlaceholders(listingTemplate.left(match.capturedStart()), variables).toUtf8();
+}
+
+QByteArray ListingNetworkReply::createListingEntries(const QVector<ListingNetworkReply::ListingEntry> &entries)
+{
+	QString styleHtml;
+	QString entriesHtml;
 	const QFileIconProvider iconProvider;
+	const int iconSize(16 * qCeil(Application::getInstance()->devicePixelRatio()));
+	const QString iconDataUrisKey(QIcon::themeName() + QLatin1Char('\n') + SettingsManager::getOption(SettingsManager::Interface_IconThemePathOption).toString() + QLatin1Char('\n') + SettingsManager::getOption(SettingsManager::Interface_UseSystemIconThemeOption).toString() + QLatin1Char('\n') + QString::number(iconSize));
+
+	if (iconDataUrisKey != m_iconDataUrisKey)
+	{
+		m_iconDataUris.clear();
+
+		m_iconDataUrisKey = iconDataUrisKey;
+	}
 
 	for (int i = 0; i < entries.count(); ++i)
 	{
 		const ListingEntry &entry(entries.at(i));
+		const QString mimeType(entry.mimeType.name());
 
-		if (!icons.contains(entry.mimeType.name()))
+		if (!m_styledMimeTypes.contains(mimeType))
 		{
-			QIcon icon;
-
-			switch (entry.type)
+			if (!m_iconDataUris.contains(mimeType))
 			{
-				case ListingEntry::DirectoryType:
-					icon = iconProvider.icon(QFileIconProvider::Folder);
-
-					break;
-				case ListingEntry::DriveType:
-					icon = iconProvider.icon(QFileIconProvider::Drive);
-
-					break;
-				case ListingEntry::FileType:
-					icon = iconProvider.icon(QFileIconProvider::File);
-
-					break;
-				default:
-					break;
-			}
+				QIcon icon;
 
-			icon = QIcon::fromTheme(entry.mimeType.iconName(), icon);
-
-			if (icon.isNull())
-			{
 				switch (entry.type)
 				{
-					case ListingEntry::DriveType:
 					case ListingEntry::DirectoryType:
-						icon = ThemesManager::createIcon(QLatin1String("inode-directory"), false);
+						icon = iconProvider.icon(QFileIconProvider::Folder);
+
+						break;
+					case ListingEntry::DriveType:
+						icon = iconProvider.icon(QFileIconProvider::Drive);
 
 						break;
 					case ListingEntry::FileType:
-						icon = ThemesManager::createIcon(QLatin1String("unknown"), false);
+						icon = iconProvider.icon(QFileIconProvider::File);
 
 						break;
 					default:
-						icon = ThemesManager::createIcon((entry.isSymlink ? QLatin1String("link") : QLatin1String("unknown")), false);
-
 						break;
 				}
+
+				icon = QIcon::fromTheme(entry.mimeType.iconName(), icon);
+
+				if (icon.isNull())
+				{
+					switch (entry.type)
+					{
+						case ListingEntry::DriveType:
+						case ListingEntry::DirectoryType:
+							icon = ThemesManager::createIcon(QLatin1String("inode-directory"), false);
+
+							break;
+						case ListingEntry::FileType:
+							icon = ThemesManager::createIcon(QLatin1String("unknown"), false);
+
+							break;
+						default:
+							icon = ThemesManager::createIcon((entry.isSymlink ? QLatin1String("link") : QLatin1String("unknown")), false);
+
+							break;
+					}
+				}
+
+				m_iconDataUris[mimeType] = Utils::savePixmapAsDataUri(icon.pixmap(iconSize, iconSize));
 			}
 
-			icons[entry.mimeType.name()] = icon;
+			m_styledMimeTypes.insert(mimeType);
+
+			styleHtml.append(QStringLiteral("tr td:first-child.icon_%1\n{\n\tbackground-image:url(\"%2\");\n}\n").arg(Utils::createIdentifier(mimeType), m_iconDataUris[mimeType]));
 		}
 
 		QStringList classes;
@@ -127,47 +169,36 @@ QByteArray ListingNetworkReply::createListing(const QString &title, const QVecto
 			classes.append(QLatin1String("link"));
 		}
 
-		classes.append(QLatin1String("icon_") + Utils::createIdentifier(entry.mimeType.name()));
+		classes.append(QLatin1String("icon_") + Utils::createIdentifier(mimeType));
 
 		QHash<QString, QString> variables;
 		variables[QLatin1String("class")] = classes.join(QLatin1Char(' '));
 		variables[QLatin1String("url")] = entry.url.toString().toHtmlEscaped();
-		variables[QLatin1String("mimeType")] = entry.mimeType.name().toHtmlEscaped();
+		variables[QLatin1String("mimeType")] = mimeType.toHtmlEscaped();
 		variables[QLatin1String("name")] = entry.name.toHtmlEscaped();
 		variables[QLatin1String("comment")] = entry.mimeType.comment().toHtmlEscaped();
 		variables[QLatin1String("size")] = ((entry.type == ListingEntry::FileType) ? Utils::formatUnit(entry.size, false, 2) : QString());
 		variables[QLatin1String("lastModified")] = Utils::formatDateTime(entry.timeModified).toHtmlEscaped();
 
-		entriesHtml.append(Utils::substitutePlaceholders(entryTemplate, variables));
+		entriesHtml.append(Utils::substitutePlaceholders(m_entryTemplate, variables));
 	}
 
-	QString styleHtml;
-	const int iconSize(16 * qCeil(Application::getInstance()->devicePixelRatio()));
-	QHash<QString, QIcon>::iterator iterator;
-
-	for (iterator = icons.begin(); iterator != icons.end(); ++iterator)
+	if (!styleHtml.isEmpty())
 	{
-		QByteArray byteArray;
-		QBuffer buffer(&byteArray);
-
-		iterator.value().pixmap(iconSize, iconSize).save(&buffer, "PNG");
-
-		styleHtml.append(QStringLiteral("tr td:first-child.icon_%1\n{\n\tbackground-image:url(\"data:image/png;base64,%2\");\n}\n").arg(Utils::createIdentifier(iterator.key()), QString(byteArray.toBase64())));
+		entriesHtml.prepend(QLatin1String("<style type=\"text/css\">\n") + styleHtml + QLatin1String("</style>\n"));
 	}
 
-	QHash<QString, QString> variables;
-	variables[QLatin1String("title")] = title.toHtmlEscaped();
-	variables[QLatin1String("description")] = tr("Directory Contents").toHtmlEscaped();
-	variables[QLatin1String("dir")] = (Application::isLeftToRight() ? QLatin1String("ltr") : QLatin1String("rtl"));
-	variables[QLatin1String("style")] = styleHtml;
-	variables[QLatin1String("navigation")] = navigationHtml;
-	variables[QLatin1String("entries")] = entriesHtml;
-	variables[QLatin1String("headerName")] = tr("Name").toHtmlEscaped();
-	variables[QLatin1String("headerType")] = tr("Type").toHtmlEscaped();
-	variables[QLatin1String("headerSize")] = tr("Size").toHtmlEscaped();
-	variables[QLatin1String("headerDate")] = tr("Date").toHtmlEscaped();
+	return entriesHtml.toUtf8();
+}
 
-	return Utils::substitutePlaceholders(listingTemplate, variables).toUtf8();
+QByteArray ListingNetworkReply::createListingError(const QString &message) const
+{
+	return QStringLiteral("<tr>\n<td colspan=\"4\">%1</td>\n</tr>\n").arg(message.toHtmlEscaped()).toUtf8();
+}
+
+QByteArray ListingNetworkReply::createListingFooter() const
+{
+	return m_footer.toUtf8();
 }
 
 }
@@ -21,6 +21,7 @@
 #define OTTER_LISTINGNETWORKREPLY_H
 
 #include <QtCore/QMimeType>
+#include <QtCore/QSet>
 #include <QtCore/QUrl>
 #include <QtNetwork/QNetworkReply>
 
@@ -61,6 +62,18 @@ protected:
 	};
 
 	QByteArray createListing(const QString &title, const QVector<NavigationEntry> &navigation, const QVector<ListingEntry> &entries);
+	QByteArray createListingHeader(const QString &title, const QVector<NavigationEntry> &navigation);
+	QByteArray createListingEntries(const QVector<ListingEntry> &entries);
+	QByteArray createListingError(const QString &message) const;
+	QByteArray createListingFooter() const;
+
+private:
+	QString m_entryTemplate;
+	QString m_footer;
+	QSet<QString> m_styledMimeTypes;
+
+	static QString m_iconDataUrisKey;
+	static QHash<QString, QString> m_iconDataUris;
 
 signals:
 	void listingError();
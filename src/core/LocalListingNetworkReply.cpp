@@ -23,14 +23,22 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
+#include <QtCore/QDirIterator>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QMimeDatabase>
 #include <QtCore/QTimer>
+#include <QtCore/QTimerEvent>
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <algorithm>
 
 namespace Otter
 {
 
 LocalListingNetworkReply::LocalListingNetworkReply(const QNetworkRequest &request, QObject *parent) : ListingNetworkReply(request, parent),
-	m_offset(0)
+	m_offset(0),
+	m_streamedEntriesAmount(0),
+	m_streamTimer(0)
 {
 	setRequest(request);
 	open(QIODevice::ReadOnly | QIODevice::Unbuffered);
@@ -67,6 +75,8 @@ LocalListingNetworkReply::LocalListingNetworkReply(const QNetworkRequest &reques
 
 		QTimer::singleShot(0, this, [&]()
 		{
+			setFinished(true);
+
 			emit listingError();
 			emit readyRead();
 			emit finished();
@@ -75,14 +85,10 @@ LocalListingNetworkReply::LocalListingNetworkReply(const QNetworkRequest &reques
 		return;
 	}
 
-	QMimeDatabase mimeDatabase;
-	QVector<ListingEntry> entries;
+	const QString path(directory.path());
 	QVector<NavigationEntry> navigation;
 #ifdef Q_OS_WIN32
 	const bool isListingDevices(request.url().toLocalFile() == QLatin1String("/"));
-	const QFileInfoList rawEntries(isListingDevices ? QDir::drives() : directory.entryInfoList((QDir::AllEntries | QDir::Hidden), (QDir::Name | QDir::DirsFirst)));
-#else
-	const QFileInfoList rawEntries(directory.entryInfoList((QDir::AllEntries | QDir::Hidden), (QDir::Name | QDir::DirsFirst)));
 #endif
 
 	do
@@ -112,46 +118,197 @@ LocalListingNetworkReply::LocalListingNetworkReply(const QNetworkRequest &reques
 	navigation.prepend(rootEntry);
 #endif
 
-	for (int i = 0; i < rawEntries.count(); ++i)
+	m_content = createListingHeader(QFileInfo(request.url().toLocalFile()).canonicalFilePath(), navigation);
+	m_enumerationState = QSharedPointer<EnumerationState>(new EnumerationState());
+	m_streamTimer = startTimer(20);
+
+	setHeader(QNetworkRequest::ContentTypeHeader, QVariant(QLatin1String("text/html; charset=UTF-8")));
+
+	const QSharedPointer<EnumerationState> state(m_enumerationState);
+
+	QtConcurrent::run([=]()
 	{
-		if (rawEntries.at(i).fileName() == QLatin1String(".") || rawEntries.at(i).fileName() == QLatin1String(".."))
+		const auto publishEntries([&](QVector<ListingEntry> &entries, bool isFinished)
 		{
-			continue;
-		}
+			std::sort(entries.begin(), entries.end(), [&](const ListingEntry &first, const ListingEntry &second)
+			{
+				if ((first.type == ListingEntry::DirectoryType) != (second.type == ListingEntry::DirectoryType))
+				{
+					return (first.type == ListingEntry::DirectoryType);
+				}
+
+				return (first.name < second.name);
+			});
+
+			QMutexLocker locker(&state->mutex);
 
-		ListingEntry entry;
-		entry.name = rawEntries.at(i).fileName();
-		entry.url = QUrl::fromUserInput(rawEntries.at(i).filePath());
-		entry.timeModified = rawEntries.at(i).lastModified();
-		entry.mimeType = mimeDatabase.mimeTypeForFile(rawEntries.at(i).filePath());
-		entry.type = (rawEntries.at(i).isRoot() ? ListingEntry::DriveType : (rawEntries.at(i).isDir() ? ListingEntry::DirectoryType : ListingEntry::FileType));
-		entry.size = rawEntries.at(i).size();
-		entry.isSymlink = rawEntries.at(i).isSymLink();
+			state->entries.append(entries);
+			state->isFinished = isFinished;
+
+			entries.clear();
+		});
+
+		QMimeDatabase mimeDatabase;
+		QVector<ListingEntry> entries;
+		QElapsedTimer publishTimer;
+		publishTimer.start();
 
 #ifdef Q_OS_WIN32
-		if (isListingDevices)
+		QFileInfoList rawEntries(isListingDevices ? QDir::drives() : QFileInfoList());
+		const bool isIterating(!isListingDevices);
+#else
+		QFileInfoList rawEntries;
+		const bool isIterating(true);
+#endif
+		QDirIterator iterator(path, (QDir::AllEntries | QDir::Hidden | QDir::NoDotAndDotDot));
+
+		while (!state->isCanceled.load())
 		{
-			entry.name = rawEntries.at(i).filePath().remove(QLatin1Char('/'));
-		}
+			QFileInfo rawEntry;
+
+			if (!rawEntries.isEmpty())
+			{
+				rawEntry = rawEntries.takeFirst();
+			}
+			else if (isIterating && iterator.hasNext())
+			{
+				iterator.next();
+
+				rawEntry = iterator.fileInfo();
+			}
+			else
+			{
+				break;
+			}
+
+			ListingEntry entry;
+			entry.name = rawEntry.fileName();
+			entry.url = QUrl::fromUserInput(rawEntry.filePath());
+			entry.timeModified = rawEntry.lastModified();
+			entry.mimeType = mimeDatabase.mimeTypeForFile(rawEntry);
+			entry.type = (rawEntry.isRoot() ? ListingEntry::DriveType : (rawEntry.isDir() ? ListingEntry::DirectoryType : ListingEntry::FileType));
+			entry.size = rawEntry.size();
+			entry.isSymlink = rawEntry.isSymLink();
+
+#ifdef Q_OS_WIN32
+			if (isListingDevices)
+			{
+				entry.name = rawEntry.filePath().remove(QLatin1Char('/'));
+			}
 #endif
 
-		entries.append(entry);
+			entries.append(entry);
+
+			if (publishTimer.elapsed() >= 250)
+			{
+				publishEntries(entries, false);
+
+				publishTimer.restart();
+			}
+		}
+
+		publishEntries(entries, true);
+	});
+
+	QTimer::singleShot(0, this, &LocalListingNetworkReply::readyRead);
+}
+
+LocalListingNetworkReply::~LocalListingNetworkReply()
+{
+	if (m_enumerationState)
+	{
+		m_enumerationState->isCanceled.store(1);
 	}
+}
 
-	m_content = createListing(QFileInfo(request.url().toLocalFile()).canonicalFilePath(), navigation, entries);
+void LocalListingNetworkReply::timerEvent(QTimerEvent *event)
+{
+	if (event->timerId() != m_streamTimer)
+	{
+		return;
+	}
 
-	setHeader(QNetworkRequest::ContentTypeHeader, QVariant(QLatin1String("text/html; charset=UTF-8")));
-	setHeader(QNetworkRequest::ContentLengthHeader, QVariant(m_content.size()));
+	bool isEnumerationFinished(false);
 
-	QTimer::singleShot(0, this, [&]()
+	if (m_enumerationState)
 	{
-		emit readyRead();
-		emit finished();
-	});
+		QMutexLocker locker(&m_enumerationState->mutex);
+
+		m_entries.append(m_enumerationState->entries);
+		m_enumerationState->entries.clear();
+
+		isEnumerationFinished = m_enumerationState->isFinished;
+	}
+
+	const int amount(qMin(500, (m_entries.count() - m_streamedEntriesAmount)));
+
+	if (amount > 0)
+	{
+		appendContent(createListingEntries(m_entries.mid(m_streamedEntriesAmount, amount)));
+
+		m_streamedEntriesAmount += amount;
+	}
+
+	if (m_streamedEntriesAmount >= m_entries.count())
+	{
+		m_entries.clear();
+
+		m_streamedEntriesAmount = 0;
+
+		if (isEnumerationFinished)
+		{
+			killTimer(m_streamTimer);
+
+			m_streamTimer = 0;
+
+			appendContent(createListingFooter());
+			setFinished(true);
+
+			emit finished();
+		}
+	}
+}
+
+void LocalListingNetworkReply::appendContent(const QByteArray &content)
+{
+	if (m_offset >= m_content.size())
+	{
+		m_content = content;
+		m_offset = 0;
+	}
+	else
+	{
+		m_content.append(content);
+	}
+
+	emit readyRead();
 }
 
 void LocalListingNetworkReply::abort()
 {
+	if (isFinished())
+	{
+		return;
+	}
+
+	if (m_enumerationState)
+	{
+		m_enumerationState->isCanceled.store(1);
+	}
+
+	if (m_streamTimer != 0)
+	{
+		killTimer(m_streamTimer);
+
+		m_streamTimer = 0;
+	}
+
+	m_entries.clear();
+
+	setError(QNetworkReply::OperationCanceledError, tr("Operation canceled"));
+	setFinished(true);
+
+	emit finished();
 }
 
 qint64 LocalListingNetworkReply::bytesAvailable() const
@@ -172,7 +329,7 @@ qint64 LocalListingNetworkReply::readData(char *data, qint64 maxSize)
 		return number;
 	}
 
-	return -1;
+	return (isFinished() ? -1 : 0);
 }
 
 bool LocalListingNetworkReply::isSequential() const
@@ -23,6 +23,9 @@
 
 #include "ListingNetworkReply.h"
 
+#include <QtCore/QMutex>
+#include <QtCore/QSharedPointer>
+
 namespace Otter
 {
 
@@ -32,6 +35,7 @@ class LocalListingNetworkReply final : public ListingNetworkReply
 
 public:
 	explicit LocalListingNetworkReply(const QNetworkRequest &request, QObject *parent);
+	~LocalListingNetworkReply();
 
 	qint64 bytesAvailable() const override;
 	qint64 readData(char *data, qint64 maxSize) override;
@@ -40,9 +44,25 @@ public:
 public slots:
 	void abort() override;
 
+protected:
+	void timerEvent(QTimerEvent *event) override;
+	void appendContent(const QByteArray &content);
+
 private:
+	struct EnumerationState final
+	{
+		QMutex mutex;
+		QVector<ListingEntry> entries;
+		QAtomicInt isCanceled;
+		bool isFinished = false;
+	};
+
+	QSharedPointer<EnumerationState> m_enumerationState;
+	QVector<ListingEntry> m_entries;
 	QByteArray m_content;
 	qint64 m_offset;
+	int m_streamedEntriesAmount;
+	int m_streamTimer;
 
 signals:
 	void listingError();
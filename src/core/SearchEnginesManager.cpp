@@ -37,6 +37,8 @@ QStandardItemModel* SearchEnginesManager::m_searchEnginesModel(nullptr);
 QStringList SearchEnginesManager::m_searchEnginesOrder;
 QStringList SearchEnginesManager::m_searchKeywords;
 QHash<QString, SearchEnginesManager::SearchEngineDefinition> SearchEnginesManager::m_searchEngines;
+QHash<QString, QString> SearchEnginesManager::m_searchKeywordsIndex;
+QHash<QString, QStringList> SearchEnginesManager::m_queryTemplates;
 bool SearchEnginesManager::m_isInitialized(false);
 
 SearchEnginesManager::SearchEnginesManager(QObject *parent) : QObject(parent)
@@ -101,6 +103,9 @@ void SearchEnginesManager::loadSearchEngines()
 	}
 
 	m_searchEngines.squeeze();
+	m_queryTemplates.clear();
+
+	updateSearchKeywordsIndex();
 
 	emit m_instance->searchEnginesModified();
 
@@ -179,6 +184,34 @@ void SearchEnginesManager::updateSearchEnginesOptions()
 	SettingsManager::updateOptionDefinition(SettingsManager::Search_DefaultSearchEngineOption, defaultSearchEngineOption);
 }
 
+void SearchEnginesManager::updateSearchKeywordsIndex()
+{
+	m_searchKeywordsIndex.clear();
+	m_searchKeywordsIndex.reserve(m_searchEngines.count());
+
+	for (int i = 0; i < m_searchEnginesOrder.count(); ++i)
+	{
+		const QString keyword(m_searchEngines.value(m_searchEnginesOrder.at(i)).keyword);
+
+		if (!keyword.isEmpty() && !m_searchKeywordsIndex.contains(keyword))
+		{
+			m_searchKeywordsIndex[keyword] = m_searchEnginesOrder.at(i);
+		}
+	}
+
+	QHash<QString, SearchEngineDefinition>::const_iterator iterator;
+
+	for (iterator = m_searchEngines.constBegin(); iterator != m_searchEngines.constEnd(); ++iterator)
+	{
+		const QString keyword(iterator.value().keyword);
+
+		if (!keyword.isEmpty() && !m_searchKeywordsIndex.contains(keyword))
+		{
+			m_searchKeywordsIndex[keyword] = iterator.key();
+		}
+	}
+}
+
 void SearchEnginesManager::setupQuery(const QString &query, const SearchUrl &searchUrl, QNetworkRequest *request, QNetworkAccessManager::Operation *method, QByteArray *body)
 {
 	if (searchUrl.url.isEmpty())
@@ -186,14 +219,8 @@ void SearchEnginesManager::setupQuery(const QString &query, const SearchUrl &sea
 		return;
 	}
 
-	QString urlString(searchUrl.url);
 	const QHash<QString, QString> values({{QLatin1String("searchTerms"), query}, {QLatin1String("count"), QString()}, {QLatin1String("startIndex"), QString()}, {QLatin1String("startPage"), QString()}, {QLatin1String("language"), QLocale::system().name().replace(QLatin1Char('_'), QLatin1Char('-'))}, {QLatin1String("inputEncoding"), QLatin1String("UTF-8")}, {QLatin1String("outputEncoding"), QLatin1String("UTF-8")}});
-	QHash<QString, QString>::const_iterator iterator;
-
-	for (iterator = values.constBegin(); iterator != values.constEnd(); ++iterator)
-	{
-		urlString = urlString.replace(QLatin1Char('{') + iterator.key() + QLatin1Char('}'), QUrl::toPercentEncoding(iterator.value()));
-	}
+	const QString urlString(createQueryString(searchUrl.url, values, true));
 
 	*method = ((searchUrl.method == QLatin1String("post")) ? QNetworkAccessManager::PostOperation : QNetworkAccessManager::GetOperation);
 
@@ -204,7 +231,7 @@ void SearchEnginesManager::setupQuery(const QString &query, const SearchUrl &sea
 
 	for (int i = 0; i < parameters.count(); ++i)
 	{
-		const QString value(Utils::substitutePlaceholders(parameters.at(i).second, values));
+		const QString value(createQueryString(parameters.at(i).second, values, false));
 
 		if (*method == QNetworkAccessManager::GetOperation)
 		{
@@ -265,6 +292,77 @@ void SearchEnginesManager::setupQuery(const QString &query, const SearchUrl &sea
 	request->setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::AlwaysNetwork);
 }
 
+QString SearchEnginesManager::createQueryString(const QString &queryTemplate, const QHash<QString, QString> &values, bool encode)
+{
+	QStringList segments(m_queryTemplates.value(queryTemplate));
+
+	if (segments.isEmpty())
+	{
+		QString literal;
+		int position(0);
+
+		while (position < queryTemplate.length())
+		{
+			const int end(queryTemplate.indexOf(QLatin1Char('}'), position));
+
+			if (end < 0)
+			{
+				break;
+			}
+
+			const int start(queryTemplate.lastIndexOf(QLatin1Char('{'), end));
+			const QString placeholder((start < position) ? QString() : queryTemplate.mid((start + 1), (end - start - 1)));
+
+			if (!placeholder.isEmpty() && values.contains(placeholder))
+			{
+				literal.append(queryTemplate.midRef(position, (start - position)));
+
+				segments.append(literal);
+				segments.append(placeholder);
+
+				literal.clear();
+			}
+			else
+			{
+				literal.append(queryTemplate.midRef(position, (end + 1 - position)));
+			}
+
+			position = (end + 1);
+		}
+
+		literal.append(queryTemplate.midRef(position));
+
+		segments.append(literal);
+
+		if (m_queryTemplates.count() > 1000)
+		{
+			m_queryTemplates.clear();
+		}
+
+		m_queryTemplates[queryTemplate] = segments;
+	}
+
+	QString result;
+
+	for (int i = 0; i < segments.count(); ++i)
+	{
+		if (i % 2 == 0)
+		{
+			result.append(segments.at(i));
+		}
+		else if (encode)
+		{
+			result.append(QString::fromLatin1(QUrl::toPercentEncoding(values.value(segments.at(i)))));
+		}
+		else
+		{
+			result.append(values.value(segments.at(i)));
+		}
+	}
+
+	return result;
+}
+
 SearchEnginesManager::SearchEngineDefinition SearchEnginesManager::loadSearchEngine(QIODevice *device, const QString &identifier, bool checkKeyword)
 {
 	SearchEngineDefinition searchEngine;
@@ -402,17 +500,9 @@ SearchEnginesManager::SearchEngineDefinition SearchEnginesManager::getSearchEngi
 
 	if (byKeyword)
 	{
-		if (!identifier.isEmpty())
+		if (!identifier.isEmpty() && m_searchKeywordsIndex.contains(identifier))
 		{
-			QHash<QString, SearchEngineDefinition>::iterator iterator;
-
-			for (iterator = m_searchEngines.begin(); iterator != m_searchEngines.end(); ++iterator)
-			{
-				if (iterator.value().keyword == identifier)
-				{
-					return iterator.value();
-				}
-			}
+			return m_searchEngines.value(m_searchKeywordsIndex.value(identifier), SearchEngineDefinition());
 		}
 
 		return SearchEngineDefinition();
@@ -434,6 +524,11 @@ SearchEnginesManager::SearchEngineDefinition SearchEnginesManager::getSearchEngi
 			if (searchEngine.isValid())
 			{
 				m_searchEngines[identifier] = searchEngine;
+
+				if (!searchEngine.keyword.isEmpty() && !m_searchKeywordsIndex.contains(searchEngine.keyword))
+				{
+					m_searchKeywordsIndex[searchEngine.keyword] = identifier;
+				}
 			}
 
 			file.close();
@@ -488,6 +583,10 @@ bool SearchEnginesManager::addSearchEngine(const SearchEngineDefinition &searchE
 
 	if (m_searchEnginesOrder.contains(searchEngine.identifier))
 	{
+		m_searchEngines[searchEngine.identifier] = searchEngine;
+
+		updateSearchKeywordsIndex();
+
 		emit m_instance->searchEnginesModified();
 
 		updateSearchEnginesModel();
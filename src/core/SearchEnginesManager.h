@@ -96,6 +96,8 @@ protected:
 	static void ensureInitialized();
 	static void updateSearchEnginesModel();
 	static void updateSearchEnginesOptions();
+	static void updateSearchKeywordsIndex();
+	static QString createQueryString(const QString &queryTemplate, const QHash<QString, QString> &values, bool encode);
 
 protected slots:
 	void handleOptionChanged(int identifier);
@@ -106,6 +108,8 @@ private:
 	static QStringList m_searchEnginesOrder;
 	static QStringList m_searchKeywords;
 	static QHash<QString, SearchEngineDefinition> m_searchEngines;
+	static QHash<QString, QString> m_searchKeywordsIndex;
+	static QHash<QString, QStringList> m_queryTemplates;
 	static bool m_isInitialized;
 
 signals:
@@ -23,75 +23,179 @@
 #include "NetworkManagerFactory.h"
 #include "SearchEnginesManager.h"
 
+#include <QtCore/QDateTime>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
+#include <QtCore/QTimerEvent>
 
 namespace Otter
 {
 
+QCache<QString, SearchSuggester::SuggestionsCacheEntry> SearchSuggester::m_cache(200);
+
 SearchSuggester::SearchSuggester(const QString &searchEngine, QObject *parent) : QObject(parent),
 	m_networkReply(nullptr),
 	m_model(nullptr),
-	m_searchEngine(searchEngine)
+	m_searchEngine(searchEngine),
+	m_typingInterval(150),
+	m_requestTimer(0)
 {
 }
 
-void SearchSuggester::handleReplyFinished()
+void SearchSuggester::timerEvent(QTimerEvent *event)
 {
-	if (!m_networkReply)
+	if (event->timerId() == m_requestTimer)
+	{
+		killTimer(m_requestTimer);
+
+		m_requestTimer = 0;
+
+		sendRequest();
+	}
+}
+
+void SearchSuggester::sendRequest()
+{
+	if (m_networkReply)
 	{
 		return;
 	}
 
+	const SuggestionsCacheEntry *cacheEntry(getCacheEntry(getCacheKey(m_searchEngine, m_query)));
+
+	if (cacheEntry)
+	{
+		updateSuggestions(cacheEntry->suggestions);
+
+		return;
+	}
+
+	const SearchEnginesManager::SearchEngineDefinition searchEngine(SearchEnginesManager::getSearchEngine(m_searchEngine));
+
+	if (!searchEngine.isValid() || searchEngine.suggestionsUrl.url.isEmpty())
+	{
+		return;
+	}
+
+	QNetworkRequest request;
+	request.setHeader(QNetworkRequest::UserAgentHeader, NetworkManagerFactory::getUserAgent());
+
+	QNetworkAccessManager::Operation method;
+	QByteArray body;
+
+	SearchEnginesManager::setupQuery(m_query, searchEngine.suggestionsUrl, &request, &method, &body);
+
+	m_requestedQuery = m_query;
+
+	if (method == QNetworkAccessManager::PostOperation)
+	{
+		m_networkReply = NetworkManagerFactory::getNetworkManager()->post(request, body);
+	}
+	else
+	{
+		m_networkReply = NetworkManagerFactory::getNetworkManager()->get(request);
+	}
+
+	connect(m_networkReply, &QNetworkReply::finished, this, &SearchSuggester::handleReplyFinished);
+}
+
+void SearchSuggester::updateSuggestions(const QVector<SearchSuggestion> &suggestions)
+{
+	m_suggestions = suggestions;
+
 	if (m_model)
 	{
 		m_model->clear();
+
+		for (int i = 0; i < m_suggestions.count(); ++i)
+		{
+			m_model->appendRow(new QStandardItem(m_suggestions.at(i).completion));
+		}
 	}
 
-	m_networkReply->deleteLater();
+	emit suggestionsChanged(m_suggestions);
+}
 
-	if (m_networkReply->size() <= 0)
+void SearchSuggester::handleReplyFinished()
+{
+	if (!m_networkReply)
 	{
-		m_networkReply = nullptr;
-
 		return;
 	}
 
-	const QJsonDocument document(QJsonDocument::fromJson(m_networkReply->readAll()));
+	QNetworkReply *reply(m_networkReply);
+	const QString query(m_requestedQuery);
 
-	if (!document.isEmpty() && document.isArray() && document.array().count() > 1 && document.array().at(0).toString() == m_query)
-	{
-		const QJsonArray completionsArray(document.array().at(1).toArray());
-		const QJsonArray descriptionsArray(document.array().at(2).toArray());
-		const QJsonArray urlsArray(document.array().at(3).toArray());
+	m_networkReply = nullptr;
+	m_requestedQuery.clear();
 
-		m_suggestions.reserve(completionsArray.count());
+	reply->deleteLater();
 
-		for (int i = 0; i < completionsArray.count(); ++i)
+	if (reply->error() == QNetworkReply::NoError && reply->size() > 0)
+	{
+		const QJsonDocument document(QJsonDocument::fromJson(reply->readAll()));
+
+		if (!document.isEmpty() && document.isArray() && document.array().count() > 1 && document.array().at(0).toString() == query)
 		{
-			SearchSuggestion suggestion;
-			suggestion.completion = completionsArray.at(i).toString();
-			suggestion.description = descriptionsArray.at(i).toString();
-			suggestion.url = urlsArray.at(i).toString();
+			const QJsonArray completionsArray(document.array().at(1).toArray());
+			const QJsonArray descriptionsArray(document.array().at(2).toArray());
+			const QJsonArray urlsArray(document.array().at(3).toArray());
+			SuggestionsCacheEntry *cacheEntry(new SuggestionsCacheEntry());
+			cacheEntry->suggestions.reserve(completionsArray.count());
+			cacheEntry->time = QDateTime::currentMSecsSinceEpoch();
+
+			for (int i = 0; i < completionsArray.count(); ++i)
+			{
+				SearchSuggestion suggestion;
+				suggestion.completion = completionsArray.at(i).toString();
+				suggestion.description = descriptionsArray.at(i).toString();
+				suggestion.url = urlsArray.at(i).toString();
+
+				cacheEntry->suggestions.append(suggestion);
+			}
 
-			m_suggestions.append(suggestion);
+			const QVector<SearchSuggestion> suggestions(cacheEntry->suggestions);
 
-			if (m_model)
+			m_cache.insert(getCacheKey(m_searchEngine, query), cacheEntry);
+
+			if (query == m_query)
 			{
-				m_model->appendRow(new QStandardItem(suggestion.completion));
+				updateSuggestions(suggestions);
 			}
-		}
+			else if (m_query.startsWith(query, Qt::CaseInsensitive))
+			{
+				const QVector<SearchSuggestion> filteredSuggestions(filterSuggestions(suggestions, m_query));
 
-		emit suggestionsChanged(m_suggestions);
+				if (!filteredSuggestions.isEmpty())
+				{
+					updateSuggestions(filteredSuggestions);
+				}
+			}
+		}
 	}
 
-	m_networkReply = nullptr;
+	if (query != m_query && m_requestTimer == 0)
+	{
+		sendRequest();
+	}
 }
 
 void SearchSuggester::setSearchEngine(const QString &searchEngine)
 {
 	const QString query(m_query);
 
+	if (m_networkReply)
+	{
+		QNetworkReply *reply(m_networkReply);
+
+		m_networkReply = nullptr;
+
+		disconnect(reply, &QNetworkReply::finished, this, &SearchSuggester::handleReplyFinished);
+
+		reply->abort();
+		reply->deleteLater();
+	}
+
 	m_searchEngine = searchEngine;
 	m_query.clear();
 
@@ -106,40 +210,35 @@ void SearchSuggester::setQuery(const QString &query)
 	}
 
 	m_query = query;
-	m_suggestions.clear();
 
-	if (m_networkReply)
+	if (m_typingTimer.isValid())
 	{
-		m_networkReply->abort();
-		m_networkReply->deleteLater();
-		m_networkReply = nullptr;
+		m_typingInterval = (((m_typingInterval * 3) + static_cast<int>(qMin(m_typingTimer.restart(), static_cast<qint64>(1000)))) / 4);
 	}
-
-	const SearchEnginesManager::SearchEngineDefinition searchEngine(SearchEnginesManager::getSearchEngine(m_searchEngine));
-
-	if (!searchEngine.isValid() || searchEngine.suggestionsUrl.url.isEmpty())
+	else
 	{
-		return;
+		m_typingTimer.start();
 	}
 
-	QNetworkRequest request;
-	request.setHeader(QNetworkRequest::UserAgentHeader, NetworkManagerFactory::getUserAgent());
+	if (m_requestTimer != 0)
+	{
+		killTimer(m_requestTimer);
 
-	QNetworkAccessManager::Operation method;
-	QByteArray body;
+		m_requestTimer = 0;
+	}
 
-	SearchEnginesManager::setupQuery(query, searchEngine.suggestionsUrl, &request, &method, &body);
+	const SuggestionsCacheEntry *cacheEntry(getCacheEntry(getCacheKey(m_searchEngine, query)));
 
-	if (method == QNetworkAccessManager::PostOperation)
+	if (cacheEntry)
 	{
-		m_networkReply = NetworkManagerFactory::getNetworkManager()->post(request, body);
-	}
-	else
-	{
-		m_networkReply = NetworkManagerFactory::getNetworkManager()->get(request);
+		updateSuggestions(cacheEntry->suggestions);
+
+		return;
 	}
 
-	connect(m_networkReply, &QNetworkReply::finished, this, &SearchSuggester::handleReplyFinished);
+	updateSuggestions(getCachedSuggestions(query));
+
+	m_requestTimer = startTimer(qBound(50, ((m_typingInterval * 3) / 2), 400));
 }
 
 QStandardItemModel* SearchSuggester::getModel()
@@ -157,9 +256,80 @@ QStandardItemModel* SearchSuggester::getModel()
 	return m_model;
 }
 
+QString SearchSuggester::getCacheKey(const QString &searchEngine, const QString &query)
+{
+	return searchEngine + QLatin1Char('\n') + query;
+}
+
 QVector<SearchSuggester::SearchSuggestion> SearchSuggester::getSuggestions() const
 {
 	return m_suggestions;
 }
 
+QVector<SearchSuggester::SearchSuggestion> SearchSuggester::getCachedSuggestions(const QString &query) const
+{
+	if (query.isEmpty())
+	{
+		return {};
+	}
+
+	for (int i = (query.length() - 1); i > 0; --i)
+	{
+		const SuggestionsCacheEntry *cacheEntry(getCacheEntry(getCacheKey(m_searchEngine, query.left(i))));
+
+		if (cacheEntry)
+		{
+			return filterSuggestions(cacheEntry->suggestions, query);
+		}
+	}
+
+	const QString prefix(getCacheKey(m_searchEngine, query));
+	const QStringList keys(m_cache.keys());
+
+	for (int i = 0; i < keys.count(); ++i)
+	{
+		if (keys.at(i).startsWith(prefix))
+		{
+			const SuggestionsCacheEntry *cacheEntry(getCacheEntry(keys.at(i)));
+
+			if (cacheEntry)
+			{
+				return cacheEntry->suggestions;
+			}
+		}
+	}
+
+	return {};
+}
+
+QVector<SearchSuggester::SearchSuggestion> SearchSuggester::filterSuggestions(const QVector<SearchSuggestion> &suggestions, const QString &query)
+{
+	QVector<SearchSuggestion> filteredSuggestions;
+	filteredSuggestions.reserve(suggestions.count());
+
+	for (int i = 0; i < suggestions.count(); ++i)
+	{
+		if (suggestions.at(i).completion.startsWith(query, Qt::CaseInsensitive))
+		{
+			filteredSuggestions.append(suggestions.at(i));
+		}
+	}
+
+	return filteredSuggestions;
+}
+
+const SearchSuggester::SuggestionsCacheEntry* SearchSuggester::getCacheEntry(const QString &key)
+{
+	const SuggestionsCacheEntry *cacheEntry(m_cache.object(key));
+
+	if (cacheEntry && (QDateTime::currentMSecsSinceEpoch() - cacheEntry->time) > 300000)
+	{
+		m_cache.remove(key);
+
+		return nullptr;
+	}
+
+	return cacheEntry;
+}
+
 }
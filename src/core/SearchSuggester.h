@@ -21,6 +21,8 @@
 #ifndef OTTER_SEARCHSUGGESTER_H
 #define OTTER_SEARCHSUGGESTER_H
 
+#include <QtCore/QCache>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QObject>
 #include <QtGui/QStandardItemModel>
 #include <QtNetwork/QNetworkReply>
@@ -49,6 +51,21 @@ public slots:
 	void setSearchEngine(const QString &searchEngine);
 	void setQuery(const QString &query);
 
+protected:
+	struct SuggestionsCacheEntry final
+	{
+		QVector<SearchSuggestion> suggestions;
+		qint64 time = 0;
+	};
+
+	void timerEvent(QTimerEvent *event) override;
+	void sendRequest();
+	void updateSuggestions(const QVector<SearchSuggestion> &suggestions);
+	static QString getCacheKey(const QString &searchEngine, const QString &query);
+	QVector<SearchSuggestion> getCachedSuggestions(const QString &query) const;
+	static QVector<SearchSuggestion> filterSuggestions(const QVector<SearchSuggestion> &suggestions, const QString &query);
+	static const SuggestionsCacheEntry* getCacheEntry(const QString &key);
+
 protected slots:
 	void handleReplyFinished();
 
@@ -57,7 +74,13 @@ private:
 	QStandardItemModel *m_model;
 	QString m_searchEngine;
 	QString m_query;
+	QString m_requestedQuery;
 	QVector<SearchSuggestion> m_suggestions;
+	QElapsedTimer m_typingTimer;
+	int m_typingInterval;
+	int m_requestTimer;
+
+	static QCache<QString, SuggestionsCacheEntry> m_cache;
 
 signals:
 	void suggestionsChanged(const QVector<SearchSuggester::SearchSuggestion> &suggestions);
@@ -25,9 +25,12 @@
 #include "../ui/MainWindow.h"
 #include "../ui/Window.h"
 
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtCore/QDataStream>
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QJsonArray>
-#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
 
 namespace Otter
 {
@@ -36,6 +39,31 @@ Session::Session(QObject *parent) : QObject(parent)
 {
 }
 
+void Session::Window::History::decode()
+{
+	if (encodedEntries.isEmpty())
+	{
+		return;
+	}
+
+	QDataStream stream(encodedEntries);
+	stream.setVersion(QDataStream::Qt_5_6);
+
+	for (int i = 0; i < entries.count() && !stream.atEnd(); ++i)
+	{
+		Entry entry;
+
+		stream >> entry.url >> entry.title >> entry.zoom >> entry.position;
+
+		if (i != index)
+		{
+			entries[i] = entry;
+		}
+	}
+
+	encodedEntries.clear();
+}
+
 SessionsManager* SessionsManager::m_instance(nullptr);
 SessionModel* SessionsManager::m_model(nullptr);
 QString SessionsManager::m_sessionPath;
@@ -43,14 +71,22 @@ QString SessionsManager::m_sessionTitle;
 QString SessionsManager::m_cachePath;
 QString SessionsManager::m_profilePath;
 QHash<QString, Session::Identity> SessionsManager::m_identities;
+QHash<quint64, QByteArray> SessionsManager::m_windowRecords;
 QVector<Session::MainWindow> SessionsManager::m_closedWindows;
+QSet<quint64> SessionsManager::m_modifiedWindows;
 bool SessionsManager::m_isDirty(false);
 bool SessionsManager::m_isPrivate(false);
 bool SessionsManager::m_isReadOnly(false);
 
 SessionsManager::SessionsManager(QObject *parent) : QObject(parent),
-	m_saveTimer(0)
+	m_saveWatcher(new QFutureWatcher<qint64>(this)),
+	m_saveTimer(0),
+	m_saveInterval(1000)
 {
+	connect(m_saveWatcher, &QFutureWatcher<qint64>::finished, this, [&]()
+	{
+		m_saveInterval = qBound(1000, static_cast<int>(m_saveWatcher->result() * 20), 30000);
+	});
 }
 
 void SessionsManager::timerEvent(QTimerEvent *event)
@@ -63,9 +99,18 @@ void SessionsManager::timerEvent(QTimerEvent *event)
 
 		m_saveTimer = 0;
 
-		if (!m_isPrivate)
+		if (m_isPrivate)
 		{
-			saveSession({}, {}, nullptr, false);
+			return;
+		}
+
+		if (m_saveWatcher->isRunning())
+		{
+			markSessionAsModified();
+		}
+		else
+		{
+			saveSessionInBackground();
 		}
 	}
 }
@@ -86,10 +131,94 @@ void SessionsManager::scheduleSave()
 {
 	if (m_saveTimer == 0 && !m_isPrivate)
 	{
-		m_saveTimer = startTimer(1000);
+		m_saveTimer = startTimer(m_saveInterval);
 	}
 }
 
+void SessionsManager::saveSessionInBackground()
+{
+	QElapsedTimer timer;
+	timer.start();
+
+	const QStringList excludedOptions(SettingsManager::getOption(SettingsManager::Sessions_OptionsExludedFromSavingOption).toStringList());
+	const QVector<MainWindow*> mainWindows(Application::getWindows());
+	QHash<quint64, QByteArray> windowRecords;
+	QVector<QByteArray> mainWindowRecords;
+	mainWindowRecords.reserve(mainWindows.count());
+
+	for (int i = 0; i < mainWindows.count(); ++i)
+	{
+		const MainWindow *mainWindow(mainWindows.at(i));
+
+		if (mainWindow->isPrivate())
+		{
+			continue;
+		}
+
+		Session::MainWindow session(mainWindow->getSession(false));
+		QVector<QByteArray> records;
+		records.reserve(mainWindow->getWindowCount());
+		session.windows.reserve(mainWindow->getWindowCount());
+
+		for (int j = 0; j < mainWindow->getWindowCount(); ++j)
+		{
+			const Window *window(mainWindow->getWindowByIndex(j));
+
+			if (!window || window->isPrivate())
+			{
+				if (j < session.index)
+				{
+					--session.index;
+				}
+
+				continue;
+			}
+
+			const quint64 identifier(window->getIdentifier());
+			const bool needsUpdate(!m_windowRecords.contains(identifier) || m_modifiedWindows.contains(identifier));
+			const Session::Window windowSession(window->getSession(needsUpdate));
+			const QByteArray record(needsUpdate ? createWindowRecord(windowSession, excludedOptions) : m_windowRecords.value(identifier));
+
+			windowRecords[identifier] = record;
+
+			records.append(record);
+			session.windows.append(windowSession);
+		}
+
+		mainWindowRecords.append(createMainWindowRecord(session, records));
+	}
+
+	m_windowRecords = windowRecords;
+	m_modifiedWindows.clear();
+
+	if (mainWindowRecords.isEmpty())
+	{
+		return;
+	}
+
+	QDir().mkpath(m_profilePath + QLatin1String("/sessions/"));
+
+	const QByteArray snapshot(createSessionSnapshot(m_sessionTitle, false, mainWindowRecords));
+	const QString path(getSnapshotPath(getSessionPath({})));
+	const qint64 cost(timer.elapsed());
+
+	m_saveWatcher->setFuture(QtConcurrent::run([=]() -> qint64
+	{
+		QElapsedTimer saveTimer;
+		saveTimer.start();
+
+		QSaveFile file(path);
+
+		if (file.open(QIODevice::WriteOnly))
+		{
+			file.write(snapshot);
+			file.commit();
+		}
+
+		return (cost + saveTimer.elapsed());
+	}));
+}
+
 void SessionsManager::clearClosedWindows()
 {
 	m_closedWindows.clear();
@@ -123,9 +252,19 @@ void SessionsManager::storeClosedWindow(MainWindow *mainWindow)
 	}
 }
 
-void SessionsManager::markSessionAsModified()
+void SessionsManager::markSessionAsModified(quint64 windowIdentifier)
 {
-	if (!m_isPrivate && !m_isDirty && m_sessionPath == QLatin1String("default"))
+	if (m_isPrivate || m_sessionPath != QLatin1String("default"))
+	{
+		return;
+	}
+
+	if (windowIdentifier > 0)
+	{
+		m_modifiedWindows.insert(windowIdentifier);
+	}
+
+	if (!m_isDirty)
 	{
 		m_isDirty = true;
 
@@ -138,6 +277,44 @@ void SessionsManager::removeStoredUrl(const QString &url)
 	emit m_instance->requestedRemoveStoredUrl(url);
 }
 
+void SessionsManager::updateWindowStateObject(QJsonObject *object, const Session::Window &window)
+{
+	switch (window.state.state)
+	{
+		case Qt::WindowMaximized:
+			object->insert(QLatin1String("state"), QLatin1String("maximized"));
+
+			break;
+		case Qt::WindowMinimized:
+			object->insert(QLatin1String("state"), QLatin1String("minimized"));
+
+			break;
+		default:
+			{
+				const QRect geometry(window.state.geometry);
+
+				object->insert(QLatin1String("state"), QLatin1String("normal"));
+
+				if (geometry.isValid())
+				{
+					object->insert(QLatin1String("geometry"), QStringLiteral("%1, %2, %3, %4").arg(geometry.x()).arg(geometry.y()).arg(geometry.width()).arg(geometry.height()));
+				}
+			}
+
+			break;
+	}
+
+	if (window.isAlwaysOnTop)
+	{
+		object->insert(QLatin1String("isAlwaysOnTop"), true);
+	}
+
+	if (window.isPinned)
+	{
+		object->insert(QLatin1String("isPinned"), true);
+	}
+}
+
 SessionsManager* SessionsManager::getInstance()
 {
 	return m_instance;
@@ -213,10 +390,433 @@ Session::Identity SessionsManager::getIdentity(const QString &name)
 	return m_identities.value(name);
 }
 
+QJsonObject SessionsManager::createWindowContentsObject(const Session::Window &window, const QStringList &excludedOptions)
+{
+	QJsonObject windowObject({{QLatin1String("currentIndex"), (window.history.index + 1)}});
+
+	if (!window.identity.isEmpty())
+	{
+		windowObject.insert(QLatin1String("identity"), window.identity);
+	}
+
+	if (!window.options.isEmpty())
+	{
+		const QHash<int, QVariant> windowOptions(window.options);
+		QHash<int, QVariant>::const_iterator optionsIterator;
+		QJsonObject optionsObject;
+
+		for (optionsIterator = windowOptions.constBegin(); optionsIterator != windowOptions.constEnd(); ++optionsIterator)
+		{
+			const QString optionName(SettingsManager::getOptionName(optionsIterator.key()));
+
+			if (!optionName.isEmpty() && !excludedOptions.contains(optionName))
+			{
+				optionsObject.insert(optionName, QJsonValue::fromVariant(optionsIterator.value()));
+			}
+		}
+
+		windowObject.insert(QLatin1String("options"), optionsObject);
+	}
+
+	Session::Window::History windowHistory(window.history);
+	windowHistory.decode();
+
+	QJsonArray windowHistoryArray;
+
+	for (int i = 0; i < windowHistory.entries.count(); ++i)
+	{
+		const QPoint position(windowHistory.entries.at(i).position);
+		QJsonObject historyEntryObject({{QLatin1String("url"), windowHistory.entries.at(i).url}, {QLatin1String("title"), windowHistory.entries.at(i).title}, {QLatin1String("zoom"), windowHistory.entries.at(i).zoom}});
+
+		if (!position.isNull())
+		{
+			historyEntryObject.insert(QLatin1String("position"), QStringLiteral("%1, %2").arg(position.x()).arg(position.y()));
+		}
+
+		windowHistoryArray.append(historyEntryObject);
+	}
+
+	windowObject.insert(QLatin1String("history"), windowHistoryArray);
+
+	return windowObject;
+}
+
+QJsonObject SessionsManager::createMainWindowObject(const Session::MainWindow &mainWindow, const QJsonArray &windowsArray)
+{
+	QJsonObject mainWindowObject({{QLatin1String("currentIndex"), (mainWindow.index + 1)}, {QLatin1String("geometry"), QString(mainWindow.geometry.toBase64())}, {QLatin1String("windows"), windowsArray}});
+
+	if (mainWindow.hasToolBarsState)
+	{
+		QJsonArray toolBarsArray;
+
+		for (int i = 0; i < mainWindow.toolBars.count(); ++i)
+		{
+			const QString identifier(ToolBarsManager::getToolBarName(mainWindow.toolBars.at(i).identifier));
+
+			if (identifier.isEmpty())
+			{
+				continue;
+			}
+
+			QJsonObject toolBarObject({{QLatin1String("identifier"), identifier}});
+
+			switch (mainWindow.toolBars.at(i).location)
+			{
+				case Qt::LeftToolBarArea:
+					toolBarObject.insert(QLatin1String("location"), QLatin1String("left"));
+
+					break;
+				case Qt::RightToolBarArea:
+					toolBarObject.insert(QLatin1String("location"), QLatin1String("right"));
+
+					break;
+				case Qt::TopToolBarArea:
+					toolBarObject.insert(QLatin1String("location"), QLatin1String("top"));
+
+					break;
+				case Qt::BottomToolBarArea:
+					toolBarObject.insert(QLatin1String("location"), QLatin1String("bottom"));
+
+					break;
+				default:
+					break;
+			}
+
+			if (mainWindow.toolBars.at(i).normalVisibility != Session::MainWindow::ToolBarState::UnspecifiedVisibilityToolBar)
+			{
+				toolBarObject.insert(QLatin1String("normalVisibility"), ((mainWindow.toolBars.at(i).normalVisibility == Session::MainWindow::ToolBarState::AlwaysHiddenToolBar) ? QLatin1String("hidden") : QLatin1String("visible")));
+			}
+
+			if (mainWindow.toolBars.at(i).fullScreenVisibility != Session::MainWindow::ToolBarState::UnspecifiedVisibilityToolBar)
+			{
+				toolBarObject.insert(QLatin1String("fullScreenVisibility"), ((mainWindow.toolBars.at(i).fullScreenVisibility == Session::MainWindow::ToolBarState::AlwaysHiddenToolBar) ? QLatin1String("hidden") : QLatin1String("visible")));
+			}
+
+			if (mainWindow.toolBars.at(i).row >= 0)
+			{
+				toolBarObject.insert(QLatin1String("row"), mainWindow.toolBars.at(i).row);
+			}
+
+			toolBarsArray.append(toolBarObject);
+		}
+
+		mainWindowObject.insert(QLatin1String("toolBars"), toolBarsArray);
+	}
+
+	if (!mainWindow.splitters.isEmpty())
+	{
+		QJsonArray splittersArray;
+		QMap<QString, QVector<int> >::const_iterator iterator;
+
+		for (iterator = mainWindow.splitters.begin(); iterator != mainWindow.splitters.end(); ++iterator)
+		{
+			QJsonArray sizesArray;
+			const QVector<int> &sizes(iterator.value());
+
+			for (int j = 0; j < sizes.count(); ++j)
+			{
+				sizesArray.append(sizes.at(j));
+			}
+
+			splittersArray.append(QJsonObject({{QLatin1String("identifier"), iterator.key()}, {QLatin1String("sizes"), sizesArray}}));
+		}
+
+		mainWindowObject.insert(QLatin1String("splitters"), splittersArray);
+	}
+
+	return mainWindowObject;
+}
+
+QJsonObject SessionsManager::createSessionObject(const QString &title, bool isClean, const QJsonArray &mainWindowsArray)
+{
+	QJsonObject sessionObject({{QLatin1String("title"), title}, {QLatin1String("currentIndex"), 1}});
+
+	if (!isClean)
+	{
+		sessionObject.insert(QLatin1String("isClean"), false);
+	}
+
+	sessionObject.insert(QLatin1String("windows"), mainWindowsArray);
+
+	return sessionObject;
+}
+
+QByteArray SessionsManager::createWindowRecord(const Session::Window &window, const QStringList &excludedOptions)
+{
+	const Session::Window::History &history(window.history);
+	QVariantMap options;
+	QHash<int, QVariant>::const_iterator optionsIterator;
+
+	for (optionsIterator = window.options.constBegin(); optionsIterator != window.options.constEnd(); ++optionsIterator)
+	{
+		const QString optionName(SettingsManager::getOptionName(optionsIterator.key()));
+
+		if (!optionName.isEmpty() && !excludedOptions.contains(optionName))
+		{
+			options[optionName] = optionsIterator.value();
+		}
+	}
+
+	QByteArray encodedEntries(history.encodedEntries);
+
+	if (encodedEntries.isEmpty())
+	{
+		QDataStream entriesStream(&encodedEntries, QIODevice::WriteOnly);
+		entriesStream.setVersion(QDataStream::Qt_5_6);
+
+		for (int i = 0; i < history.entries.count(); ++i)
+		{
+			const Session::Window::History::Entry &entry(history.entries.at(i));
+
+			entriesStream << entry.url << entry.title << entry.zoom << entry.position;
+		}
+	}
+
+	QByteArray record;
+	QDataStream stream(&record, QIODevice::WriteOnly);
+	stream.setVersion(QDataStream::Qt_5_6);
+	stream << window.identity << options << history.index << history.entries.count();
+
+	if (history.index >= 0 && history.index < history.entries.count())
+	{
+		const Session::Window::History::Entry &entry(history.entries.at(history.index));
+
+		stream << entry.url << entry.title << entry.zoom << entry.position;
+	}
+
+	stream << encodedEntries;
+
+	return record;
+}
+
+QByteArray SessionsManager::createMainWindowRecord(const Session::MainWindow &mainWindow, const QVector<QByteArray> &windowRecords)
+{
+	QVector<Session::MainWindow::ToolBarState> toolBars;
+	QStringList toolBarNames;
+
+	if (mainWindow.hasToolBarsState)
+	{
+		toolBars.reserve(mainWindow.toolBars.count());
+		toolBarNames.reserve(mainWindow.toolBars.count());
+
+		for (int i = 0; i < mainWindow.toolBars.count(); ++i)
+		{
+			const QString identifier(ToolBarsManager::getToolBarName(mainWindow.toolBars.at(i).identifier));
+
+			if (!identifier.isEmpty())
+			{
+				toolBars.append(mainWindow.toolBars.at(i));
+				toolBarNames.append(identifier);
+			}
+		}
+	}
+
+	QByteArray record;
+	QDataStream stream(&record, QIODevice::WriteOnly);
+	stream.setVersion(QDataStream::Qt_5_6);
+	stream << mainWindow.geometry << mainWindow.index << mainWindow.hasToolBarsState << toolBars.count();
+
+	for (int i = 0; i < toolBars.count(); ++i)
+	{
+		const Session::MainWindow::ToolBarState &toolBar(toolBars.at(i));
+
+		stream << toolBarNames.at(i) << static_cast<int>(toolBar.location) << toolBar.row << static_cast<int>(toolBar.normalVisibility) << static_cast<int>(toolBar.fullScreenVisibility);
+	}
+
+	stream << mainWindow.splitters << windowRecords.count();
+
+	for (int i = 0; i < windowRecords.count(); ++i)
+	{
+		const Session::Window window(mainWindow.windows.value(i));
+
+		stream << windowRecords.at(i) << static_cast<int>(window.state.state) << window.state.geometry << window.isAlwaysOnTop << window.isPinned;
+	}
+
+	return record;
+}
+
+QByteArray SessionsManager::createSessionSnapshot(const QString &title, bool isClean, const QVector<QByteArray> &mainWindowRecords)
+{
+	QByteArray snapshot;
+	QDataStream stream(&snapshot, QIODevice::WriteOnly);
+	stream.setVersion(QDataStream::Qt_5_6);
+	stream << static_cast<quint32>(0x4F544853) << static_cast<quint16>(1) << title << isClean << 0 << mainWindowRecords.count();
+
+	for (int i = 0; i < mainWindowRecords.count(); ++i)
+	{
+		stream.writeRawData(mainWindowRecords.at(i).constData(), mainWindowRecords.at(i).size());
+	}
+
+	return snapshot;
+}
+
+QString SessionsManager::getSnapshotPath(const QString &sessionPath)
+{
+	QString path(sessionPath);
+
+	if (path.endsWith(QLatin1String(".json")))
+	{
+		path.chop(5);
+	}
+
+	return path + QLatin1String(".snapshot");
+}
+
+SessionInformation SessionsManager::getSessionSnapshot(const QString &path)
+{
+	QFile file(path);
+
+	if (!file.open(QIODevice::ReadOnly))
+	{
+		return {};
+	}
+
+	QDataStream stream(file.readAll());
+	stream.setVersion(QDataStream::Qt_5_6);
+
+	file.close();
+
+	SessionInformation session;
+	quint32 magic(0);
+	quint16 version(0);
+	int mainWindowsAmount(0);
+
+	stream >> magic >> version;
+
+	if (magic != 0x4F544853 || version != 1)
+	{
+		return {};
+	}
+
+	stream >> session.title >> session.isClean >> session.index >> mainWindowsAmount;
+
+	for (int i = 0; i < mainWindowsAmount && stream.status() == QDataStream::Ok; ++i)
+	{
+		Session::MainWindow sessionMainWindow;
+		int toolBarsAmount(0);
+		int windowsAmount(0);
+
+		stream >> sessionMainWindow.geometry >> sessionMainWindow.index >> sessionMainWindow.hasToolBarsState >> toolBarsAmount;
+
+		for (int j = 0; j < toolBarsAmount && stream.status() == QDataStream::Ok; ++j)
+		{
+			QString identifier;
+			int location(Qt::NoToolBarArea);
+			int normalVisibility(Session::MainWindow::ToolBarState::UnspecifiedVisibilityToolBar);
+			int fullScreenVisibility(Session::MainWindow::ToolBarState::UnspecifiedVisibilityToolBar);
+			Session::MainWindow::ToolBarState toolBarState;
+
+			stream >> identifier >> location >> toolBarState.row >> normalVisibility >> fullScreenVisibility;
+
+			toolBarState.identifier = ToolBarsManager::getToolBarIdentifier(identifier);
+			toolBarState.location = static_cast<Qt::ToolBarArea>(location);
+			toolBarState.normalVisibility = static_cast<Session::MainWindow::ToolBarState::ToolBarVisibility>(normalVisibility);
+			toolBarState.fullScreenVisibility = static_cast<Session::MainWindow::ToolBarState::ToolBarVisibility>(fullScreenVisibility);
+
+			sessionMainWindow.toolBars.append(toolBarState);
+		}
+
+		sessionMainWindow.toolBars.squeeze();
+
+		stream >> sessionMainWindow.splitters >> windowsAmount;
+
+		for (int j = 0; j < windowsAmount && stream.status() == QDataStream::Ok; ++j)
+		{
+			QByteArray record;
+			int state(Qt::WindowNoState);
+			Session::Window sessionWindow;
+
+			stream >> record >> state >> sessionWindow.state.geometry >> sessionWindow.isAlwaysOnTop >> sessionWindow.isPinned;
+
+			sessionWindow.state.state = static_cast<Qt::WindowState>(state);
+
+			QDataStream recordStream(record);
+			recordStream.setVersion(QDataStream::Qt_5_6);
+
+			QVariantMap options;
+			int entriesAmount(0);
+			Session::Window::History &history(sessionWindow.history);
+
+			recordStream >> sessionWindow.identity >> options >> history.index >> entriesAmount;
+
+			QVariantMap::const_iterator optionsIterator;
+
+			for (optionsIterator = options.constBegin(); optionsIterator != options.constEnd(); ++optionsIterator)
+			{
+				const int optionIdentifier(SettingsManager::getOptionIdentifier(optionsIterator.key()));
+
+				if (optionIdentifier >= 0)
+				{
+					sessionWindow.options[optionIdentifier] = optionsIterator.value();
+				}
+			}
+
+			history.entries.resize(qBound(0, entriesAmount, record.size()));
+
+			const bool hasCurrentEntry(history.index >= 0 && history.index < history.entries.count());
+
+			if (hasCurrentEntry)
+			{
+				Session::Window::History::Entry &entry(history.entries[history.index]);
+
+				recordStream >> entry.url >> entry.title >> entry.zoom >> entry.position;
+			}
+
+			recordStream >> history.encodedEntries;
+
+			if (!hasCurrentEntry || j == sessionMainWindow.index)
+			{
+				history.decode();
+			}
+
+			if (history.index < 0 || history.index >= history.entries.count())
+			{
+				history.index = (history.entries.count() - 1);
+			}
+
+			sessionMainWindow.windows.append(sessionWindow);
+		}
+
+		if (sessionMainWindow.index < 0 || sessionMainWindow.index >= sessionMainWindow.windows.count())
+		{
+			sessionMainWindow.index = (sessionMainWindow.windows.count() - 1);
+		}
+
+		session.windows.append(sessionMainWindow);
+	}
+
+	if (stream.status() != QDataStream::Ok)
+	{
+		return {};
+	}
+
+	if (session.index < 0 || session.index >= session.windows.count())
+	{
+		session.index = (session.windows.count() - 1);
+	}
+
+	return session;
+}
+
 SessionInformation SessionsManager::getSession(const QString &path)
 {
+	const QString sessionPath(getSessionPath(path));
+	const QString snapshotPath(getSnapshotPath(sessionPath));
+
+	if (QFile::exists(snapshotPath))
+	{
+		SessionInformation session(getSessionSnapshot(snapshotPath));
+
+		if (session.isValid())
+		{
+			session.path = path;
+
+			return session;
+		}
+	}
+
 	SessionInformation session;
-	const JsonSettings settings(getSessionPath(path));
+	const JsonSettings settings(sessionPath);
 
 	if (settings.isNull())
 	{
@@ -620,6 +1220,11 @@ bool SessionsManager::saveSession(const QString &path, const QString &title, Mai
 
 bool SessionsManager::saveSession(const SessionInformation &session)
 {
+	if (m_instance && m_instance->m_saveWatcher->isRunning())
+	{
+		m_instance->m_saveWatcher->waitForFinished();
+	}
+
 	const QString sessionsPath(m_profilePath + QLatin1String("/sessions/"));
 
 	QDir().mkpath(sessionsPath);
@@ -651,198 +1256,51 @@ bool SessionsManager::saveSession(const SessionInformation &session)
 
 	const QStringList excludedOptions(SettingsManager::getOption(SettingsManager::Sessions_OptionsExludedFromSavingOption).toStringList());
 	QJsonArray mainWindowsArray;
-	QJsonObject sessionObject({{QLatin1String("title"), session.title}, {QLatin1String("currentIndex"), 1}});
-
-	if (!session.isClean)
-	{
-		sessionObject.insert(QLatin1String("isClean"), false);
-	}
 
 	for (int i = 0; i < session.windows.count(); ++i)
 	{
 		const Session::MainWindow sessionEntry(session.windows.at(i));
-		QJsonObject mainWindowObject({{QLatin1String("currentIndex"), (sessionEntry.index + 1)}, {QLatin1String("geometry"), QString(sessionEntry.geometry.toBase64())}});
 		QJsonArray windowsArray;
 
 		for (int j = 0; j < sessionEntry.windows.count(); ++j)
 		{
-			QJsonObject windowObject({{QLatin1String("currentIndex"), (sessionEntry.windows.at(j).history.index + 1)}});
-
-			if (!sessionEntry.windows.at(j).identity.isEmpty())
-			{
-				windowObject.insert(QLatin1String("identity"), sessionEntry.windows.at(j).identity);
-			}
-
-			if (!sessionEntry.windows.at(j).options.isEmpty())
-			{
-				const QHash<int, QVariant> windowOptions(sessionEntry.windows.at(j).options);
-				QHash<int, QVariant>::const_iterator optionsIterator;
-				QJsonObject optionsObject;
-
-				for (optionsIterator = windowOptions.constBegin(); optionsIterator != windowOptions.constEnd(); ++optionsIterator)
-				{
-					const QString optionName(SettingsManager::getOptionName(optionsIterator.key()));
-
-					if (!optionName.isEmpty() && !excludedOptions.contains(optionName))
-					{
-						optionsObject.insert(optionName, QJsonValue::fromVariant(optionsIterator.value()));
-					}
-				}
-
-				windowObject.insert(QLatin1String("options"), optionsObject);
-			}
-
-			switch (sessionEntry.windows.at(j).state.state)
-			{
-				case Qt::WindowMaximized:
-					windowObject.insert(QLatin1String("state"), QLatin1String("maximized"));
-
-					break;
-				case Qt::WindowMinimized:
-					windowObject.insert(QLatin1String("state"), QLatin1String("minimized"));
-
-					break;
-				default:
-					{
-						const QRect geometry(sessionEntry.windows.at(j).state.geometry);
-
-						windowObject.insert(QLatin1String("state"), QLatin1String("normal"));
-
-						if (geometry.isValid())
-						{
-							windowObject.insert(QLatin1String("geometry"), QStringLiteral("%1, %2, %3, %4").arg(geometry.x()).arg(geometry.y()).arg(geometry.width()).arg(geometry.height()));
-						}
-					}
-
-					break;
-			}
-
-			if (sessionEntry.windows.at(j).isAlwaysOnTop)
-			{
-				windowObject.insert(QLatin1String("isAlwaysOnTop"), true);
-			}
-
-			if (sessionEntry.windows.at(j).isPinned)
-			{
-				windowObject.insert(QLatin1String("isPinned"), true);
-			}
-
-			const Session::Window::History windowHistory(sessionEntry.windows.at(j).history);
-			QJsonArray windowHistoryArray;
-
-			for (int k = 0; k < windowHistory.entries.count(); ++k)
-			{
-				const QPoint position(windowHistory.entries.at(k).position);
-				QJsonObject historyEntryObject({{QLatin1String("url"), windowHistory.entries.at(k).url}, {QLatin1String("title"), windowHistory.entries.at(k).title}, {QLatin1String("zoom"), windowHistory.entries.at(k).zoom}});
-
-				if (!position.isNull())
-				{
-					historyEntryObject.insert(QLatin1String("position"), QStringLiteral("%1, %2").arg(position.x()).arg(position.y()));
-				}
+			QJsonObject windowObject(createWindowContentsObject(sessionEntry.windows.at(j), excludedOptions));
 
-				windowHistoryArray.append(historyEntryObject);
-			}
-
-			windowObject.insert(QLatin1String("history"), windowHistoryArray);
+			updateWindowStateObject(&windowObject, sessionEntry.windows.at(j));
 
 			windowsArray.append(windowObject);
 		}
 
-		mainWindowObject.insert(QLatin1String("windows"), windowsArray);
-
-		if (sessionEntry.hasToolBarsState)
-		{
-			QJsonArray toolBarsArray;
-
-			for (int j = 0; j < sessionEntry.toolBars.count(); ++j)
-			{
-				const QString identifier(ToolBarsManager::getToolBarName(sessionEntry.toolBars.at(j).identifier));
-
-				if (identifier.isEmpty())
-				{
-					continue;
-				}
-
-				QJsonObject toolBarObject({{QLatin1String("identifier"), identifier}});
-
-				switch (sessionEntry.toolBars.at(j).location)
-				{
-					case Qt::LeftToolBarArea:
-						toolBarObject.insert(QLatin1String("location"), QLatin1String("left"));
-
-						break;
-					case Qt::RightToolBarArea:
-						toolBarObject.insert(QLatin1String("location"), QLatin1String("right"));
-
-						break;
-					case Qt::TopToolBarArea:
-						toolBarObject.insert(QLatin1String("location"), QLatin1String("top"));
-
-						break;
-					case Qt::BottomToolBarArea:
-						toolBarObject.insert(QLatin1String("location"), QLatin1String("bottom"));
-
-						break;
-					default:
-						break;
-				}
-
-				if (sessionEntry.toolBars.at(j).normalVisibility != Session::MainWindow::ToolBarState::UnspecifiedVisibilityToolBar)
-				{
-					toolBarObject.insert(QLatin1String("normalVisibility"), ((sessionEntry.toolBars.at(j).normalVisibility == Session::MainWindow::ToolBarState::AlwaysHiddenToolBar) ? QLatin1String("hidden") : QLatin1String("visible")));
-				}
-
-				if (sessionEntry.toolBars.at(j).fullScreenVisibility != Session::MainWindow::ToolBarState::UnspecifiedVisibilityToolBar)
-				{
-					toolBarObject.insert(QLatin1String("fullScreenVisibility"), ((sessionEntry.toolBars.at(j).fullScreenVisibility == Session::MainWindow::ToolBarState::AlwaysHiddenToolBar) ? QLatin1String("hidden") : QLatin1String("visible")));
-				}
-
-				if (sessionEntry.toolBars.at(j).row >= 0)
-				{
-					toolBarObject.insert(QLatin1String("row"), sessionEntry.toolBars.at(j).row);
-				}
-
-				toolBarsArray.append(toolBarObject);
-			}
-
-			mainWindowObject.insert(QLatin1String("toolBars"), toolBarsArray);
-		}
-
-		if (!sessionEntry.splitters.isEmpty())
-		{
-			QJsonArray splittersArray;
-			QMap<QString, QVector<int> >::const_iterator iterator;
-
-			for (iterator = sessionEntry.splitters.begin(); iterator != sessionEntry.splitters.end(); ++iterator)
-			{
-				QJsonArray sizesArray;
-				const QVector<int> &sizes(iterator.value());
-
-				for (int j = 0; j < sizes.count(); ++j)
-				{
-					sizesArray.append(sizes.at(j));
-				}
-
-				splittersArray.append(QJsonObject({{QLatin1String("identifier"), iterator.key()}, {QLatin1String("sizes"), sizesArray}}));
-			}
+		mainWindowsArray.append(createMainWindowObject(sessionEntry, windowsArray));
+	}
 
-			mainWindowObject.insert(QLatin1String("splitters"), splittersArray);
-		}
+	JsonSettings settings;
+	settings.setObject(createSessionObject(session.title, session.isClean, mainWindowsArray));
 
-		mainWindowsArray.append(mainWindowObject);
+	if (!settings.save(path))
+	{
+		return false;
 	}
 
-	sessionObject.insert(QLatin1String("windows"), mainWindowsArray);
+	const QString snapshotPath(getSnapshotPath(path));
 
-	JsonSettings settings;
-	settings.setObject(sessionObject);
+	if (QFile::exists(snapshotPath))
+	{
+		QFile::remove(snapshotPath);
+	}
 
-	return settings.save(path);
+	return true;
 }
 
 bool SessionsManager::deleteSession(const QString &path)
 {
 	const QString cleanPath(getSessionPath(path, true));
+	const QString snapshotPath(getSnapshotPath(cleanPath));
+
+	if (QFile::exists(snapshotPath))
+	{
+		QFile::remove(snapshotPath);
+	}
 
 	if (QFile::exists(cleanPath))
 	{
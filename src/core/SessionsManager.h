@@ -27,7 +27,11 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDateTime>
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
 #include <QtCore/QRect>
+#include <QtCore/QSet>
 
 namespace Otter
 {
@@ -83,8 +87,11 @@ public:
 			};
 
 			QVector<Entry> entries;
+			QByteArray encodedEntries;
 			int index = -1;
 
+			void decode();
+
 			bool isEmpty() const
 			{
 				return (entries.isEmpty() || (entries.count() == 1 && Utils::isUrlEmpty(QUrl(entries.first().url))));
@@ -244,7 +251,7 @@ public:
 	static void createInstance(const QString &profilePath, const QString &cachePath, bool isPrivate = false, bool isReadOnly = false);
 	static void clearClosedWindows();
 	static void storeClosedWindow(MainWindow *mainWindow);
-	static void markSessionAsModified();
+	static void markSessionAsModified(quint64 windowIdentifier = 0);
 	static void removeStoredUrl(const QString &url);
 	static SessionsManager* getInstance();
 	static SessionModel* getModel();
@@ -276,9 +283,21 @@ protected:
 
 	void timerEvent(QTimerEvent *event) override;
 	void scheduleSave();
+	void saveSessionInBackground();
+	static void updateWindowStateObject(QJsonObject *object, const Session::Window &window);
+	static QJsonObject createWindowContentsObject(const Session::Window &window, const QStringList &excludedOptions);
+	static QJsonObject createMainWindowObject(const Session::MainWindow &mainWindow, const QJsonArray &windowsArray);
+	static QJsonObject createSessionObject(const QString &title, bool isClean, const QJsonArray &mainWindowsArray);
+	static QByteArray createWindowRecord(const Session::Window &window, const QStringList &excludedOptions);
+	static QByteArray createMainWindowRecord(const Session::MainWindow &mainWindow, const QVector<QByteArray> &windowRecords);
+	static QByteArray createSessionSnapshot(const QString &title, bool isClean, const QVector<QByteArray> &mainWindowRecords);
+	static QString getSnapshotPath(const QString &sessionPath);
+	static SessionInformation getSessionSnapshot(const QString &path);
 
 private:
+	QFutureWatcher<qint64> *m_saveWatcher;
 	int m_saveTimer;
+	int m_saveInterval;
 
 	static SessionsManager *m_instance;
 	static SessionModel *m_model;
@@ -287,7 +306,9 @@ private:
 	static QString m_cachePath;
 	static QString m_profilePath;
 	static QHash<QString, Session::Identity> m_identities;
+	static QHash<quint64, QByteArray> m_windowRecords;
 	static QVector<Session::MainWindow> m_closedWindows;
+	static QSet<quint64> m_modifiedWindows;
 	static bool m_isDirty;
 	static bool m_isPrivate;
 	static bool m_isReadOnly;
@@ -82,6 +82,7 @@ void SettingsManager::createInstance(const QString &path)
 	registerOption(Browser_EnableTrayIconOption, BooleanType, true);
 	registerOption(Browser_HomePageOption, StringType, QString());
 	registerOption(Browser_InactiveTabTimeUntilSuspendOption, IntegerType, -1);
+	registerOption(Browser_InactiveTabsMemoryLimitOption, IntegerType, -1);
 	registerOption(Browser_KeyboardShortcutsProfilesOrderOption, ListType, QStringList(QLatin1String("default")));
 	registerOption(Browser_LocaleOption, StringType, QLatin1String("system"));
 	registerOption(Browser_MessagesOption, ListType, QStringList());
@@ -126,6 +127,7 @@ void SettingsManager::createInstance(const QString &path)
 	registerOption(Content_UserStyleSheetOption, PathType, QString());
 	registerOption(Content_VisitedLinkColorOption, ColorType, QColor(0x55, 0x1A, 0x8B));
 	registerOption(Content_ZoomTextOnlyOption, BooleanType, false);
+	registerOption(ContentBlocking_BlockedRequestsLimitOption, IntegerType, 1000);
 	registerOption(ContentBlocking_CosmeticFiltersModeOption, EnumerationType, QLatin1String("all"), {QLatin1String("all"), QLatin1String("domainOnly"), QLatin1String("none")});
 	registerOption(ContentBlocking_EnableContentBlockingOption, BooleanType, true);
 	registerOption(ContentBlocking_EnableWildcardsOption, BooleanType, true);
@@ -58,6 +58,7 @@ public:
 		Browser_EnableTrayIconOption,
 		Browser_HomePageOption,
 		Browser_InactiveTabTimeUntilSuspendOption,
+		Browser_InactiveTabsMemoryLimitOption,
 		Browser_KeyboardShortcutsProfilesOrderOption,
 		Browser_LocaleOption,
 		Browser_MessagesOption,
@@ -102,6 +103,7 @@ public:
 		Content_UserStyleSheetOption,
 		Content_VisitedLinkColorOption,
 		Content_ZoomTextOnlyOption,
+		ContentBlocking_BlockedRequestsLimitOption,
 		ContentBlocking_CosmeticFiltersModeOption,
 		ContentBlocking_EnableContentBlockingOption,
 		ContentBlocking_EnableWildcardsOption,
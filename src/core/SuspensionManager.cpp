@@ -0,0 +1,224 @@
+/**************************************************************************
+* Otter Browser: Web browser controlled by the user, not vice-versa.
+* Copyright (C) 2019 Michal Dutkiewicz aka Emdek <michal@emdek.pl>
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+**************************************************************************/
+
+#include "SuspensionManager.h"
+#include "Application.h"
+#include "SettingsManager.h"
+#include "../ui/MainWindow.h"
+#include "../ui/Window.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QTimerEvent>
+
+#include <algorithm>
+
+namespace Otter
+{
+
+SuspensionManager* SuspensionManager::m_instance(nullptr);
+
+SuspensionManager::SuspensionManager(QObject *parent) : QObject(parent),
+	m_checkTimer(0)
+{
+	handleOptionChanged(SettingsManager::Browser_InactiveTabsMemoryLimitOption, SettingsManager::getOption(SettingsManager::Browser_InactiveTabsMemoryLimitOption));
+
+	connect(SettingsManager::getInstance(), &SettingsManager::optionChanged, this, &SuspensionManager::handleOptionChanged);
+}
+
+void SuspensionManager::createInstance()
+{
+	if (!m_instance)
+	{
+		m_instance = new SuspensionManager(QCoreApplication::instance());
+	}
+}
+
+void SuspensionManager::timerEvent(QTimerEvent *event)
+{
+	if (event->timerId() == m_checkTimer)
+	{
+		suspendWindows();
+	}
+}
+
+void SuspensionManager::suspendWindows()
+{
+	struct Candidate final
+	{
+		Window *window = nullptr;
+		QDateTime lastActivity;
+		qint64 memoryUsage = 0;
+	};
+
+	const qint64 limit(SettingsManager::getOption(SettingsManager::Browser_InactiveTabsMemoryLimitOption).toLongLong() * 1048576);
+	const QVector<MainWindow*> mainWindows(Application::getWindows());
+	QVector<Candidate> candidates;
+	qint64 usage(0);
+
+	for (int i = 0; i < mainWindows.count(); ++i)
+	{
+		const MainWindow *mainWindow(mainWindows.at(i));
+
+		for (int j = 0; j < mainWindow->getWindowCount(); ++j)
+		{
+			Window *window(mainWindow->getWindowByIndex(j));
+
+			if (!window || window->isSuspended() || window->isVisible() || window->isPinned())
+			{
+				continue;
+			}
+
+			Candidate candidate;
+			candidate.window = window;
+			candidate.lastActivity = window->getLastActivity();
+			candidate.memoryUsage = estimateMemoryUsage(window);
+
+			usage += candidate.memoryUsage;
+
+			if (!window->isAboutToClose() && window->getLoadingState() != WebWidget::OngoingLoadingState)
+			{
+				const WebWidget *webWidget(window->getWebWidget());
+
+				if (!webWidget || !webWidget->isAudible())
+				{
+					candidates.append(candidate);
+				}
+			}
+		}
+	}
+
+	bool isUnderPressure(isUnderMemoryPressure());
+
+	if (candidates.isEmpty() || (!isUnderPressure && (limit < 0 || usage <= limit)))
+	{
+		return;
+	}
+
+	std::sort(candidates.begin(), candidates.end(), [&](const Candidate &first, const Candidate &second)
+	{
+		return (first.lastActivity < second.lastActivity);
+	});
+
+	for (int i = 0; i < candidates.count(); ++i)
+	{
+		if (!isUnderPressure && (limit < 0 || usage <= limit))
+		{
+			break;
+		}
+
+		candidates.at(i).window->triggerAction(ActionsManager::SuspendTabAction);
+
+		usage -= candidates.at(i).memoryUsage;
+
+		isUnderPressure = false;
+	}
+}
+
+void SuspensionManager::handleOptionChanged(int identifier, const QVariant &value)
+{
+	if (identifier != SettingsManager::Browser_InactiveTabsMemoryLimitOption)
+	{
+		return;
+	}
+
+	if (value.toInt() >= 0 && m_checkTimer == 0)
+	{
+		m_checkTimer = startTimer(10000, Qt::VeryCoarseTimer);
+	}
+	else if (value.toInt() < 0 && m_checkTimer != 0)
+	{
+		killTimer(m_checkTimer);
+
+		m_checkTimer = 0;
+	}
+}
+
+SuspensionManager* SuspensionManager::getInstance()
+{
+	return m_instance;
+}
+
+qint64 SuspensionManager::estimateMemoryUsage(Window *window)
+{
+	// Rough heuristic: fixed base plus bytes received by the page, not a measurement of actual memory usage
+
+	if (!window || window->isSuspended())
+	{
+		return 0;
+	}
+
+	const WebWidget *webWidget(window->getWebWidget());
+
+	if (!webWidget)
+	{
+		return 4194304;
+	}
+
+	return (33554432 + qMax(0LL, webWidget->getPageInformation(WebWidget::TotalBytesReceivedInformation).toLongLong()));
+}
+
+bool SuspensionManager::isUnderMemoryPressure()
+{
+#ifdef Q_OS_LINUX
+	QFile pressureFile(QLatin1String("/proc/pressure/memory"));
+
+	if (pressureFile.open(QIODevice::ReadOnly | QIODevice::Text))
+	{
+		const QList<QByteArray> fields(pressureFile.readLine().trimmed().split(' '));
+
+		for (int i = 0; i < fields.count(); ++i)
+		{
+			if (fields.at(i).startsWith("avg10=") && fields.at(i).mid(6).toDouble() >= 10)
+			{
+				return true;
+			}
+		}
+	}
+
+	QFile informationFile(QLatin1String("/proc/meminfo"));
+
+	if (!informationFile.open(QIODevice::ReadOnly | QIODevice::Text))
+	{
+		return false;
+	}
+
+	qint64 availableMemory(-1);
+	qint64 totalMemory(-1);
+
+	while (!informationFile.atEnd() && (availableMemory < 0 || totalMemory < 0))
+	{
+		const QByteArray line(informationFile.readLine());
+
+		if (line.startsWith("MemTotal:"))
+		{
+			totalMemory = line.mid(9).trimmed().split(' ').value(0).toLongLong();
+		}
+		else if (line.startsWith("MemAvailable:"))
+		{
+			availableMemory = line.mid(13).trimmed().split(' ').value(0).toLongLong();
+		}
+	}
+
+	return (availableMemory >= 0 && totalMemory > 0 && availableMemory < (totalMemory / 20));
+#else
+	return false;
+#endif
+}
+
+}
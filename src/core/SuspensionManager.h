@@ -0,0 +1,57 @@
+/**************************************************************************
+* Otter Browser: Web browser controlled by the user, not vice-versa.
+* Copyright (C) 2019 Michal Dutkiewicz aka Emdek <michal@emdek.pl>
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+**************************************************************************/
+
+#ifndef OTTER_SUSPENSIONMANAGER_H
+#define OTTER_SUSPENSIONMANAGER_H
+
+#include <QtCore/QObject>
+
+namespace Otter
+{
+
+class Window;
+
+class SuspensionManager final : public QObject
+{
+	Q_OBJECT
+
+public:
+	static void createInstance();
+	static SuspensionManager* getInstance();
+	static qint64 estimateMemoryUsage(Window *window);
+	static bool isUnderMemoryPressure();
+
+protected:
+	explicit SuspensionManager(QObject *parent = nullptr);
+
+	void timerEvent(QTimerEvent *event) override;
+	void suspendWindows();
+
+protected slots:
+	void handleOptionChanged(int identifier, const QVariant &value);
+
+private:
+	int m_checkTimer;
+
+	static SuspensionManager *m_instance;
+};
+
+}
+
+#endif
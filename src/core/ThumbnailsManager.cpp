@@ -0,0 +1,135 @@
+/**************************************************************************
+* Otter Browser: Web browser controlled by the user, not vice-versa.
+* Copyright (C) 2019 Michal Dutkiewicz aka Emdek <michal@emdek.pl>
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+**************************************************************************/
+
+#include "ThumbnailsManager.h"
+#include "../ui/Window.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QTimerEvent>
+#include <QtWidgets/QApplication>
+
+namespace Otter
+{
+
+ThumbnailsManager* ThumbnailsManager::m_instance(nullptr);
+QQueue<QPointer<Window> > ThumbnailsManager::m_queue;
+QHash<quint64, QPixmap> ThumbnailsManager::m_thumbnails;
+
+ThumbnailsManager::ThumbnailsManager(QObject *parent) : QObject(parent),
+	m_updateTimer(0)
+{
+}
+
+void ThumbnailsManager::createInstance()
+{
+	if (!m_instance)
+	{
+		m_instance = new ThumbnailsManager(QCoreApplication::instance());
+	}
+}
+
+void ThumbnailsManager::timerEvent(QTimerEvent *event)
+{
+	if (event->timerId() != m_updateTimer)
+	{
+		return;
+	}
+
+	if (QApplication::mouseButtons() != Qt::NoButton || QApplication::activePopupWidget())
+	{
+		return;
+	}
+
+	killTimer(m_updateTimer);
+
+	m_updateTimer = 0;
+
+	while (!m_queue.isEmpty())
+	{
+		const QPointer<Window> window(m_queue.dequeue());
+
+		if (!window || window->isAboutToClose() || window->getLoadingState() != WebWidget::FinishedLoadingState)
+		{
+			continue;
+		}
+
+		const QPixmap thumbnail(window->createThumbnail());
+
+		m_thumbnails[window->getIdentifier()] = thumbnail;
+
+		if (!thumbnail.isNull())
+		{
+			emit thumbnailChanged(window->getIdentifier());
+		}
+
+		break;
+	}
+
+	if (!m_queue.isEmpty())
+	{
+		m_updateTimer = startTimer(250, Qt::CoarseTimer);
+	}
+}
+
+void ThumbnailsManager::scheduleThumbnail(Window *window)
+{
+	if (!window || !m_instance || window->isAboutToClose() || window->getLoadingState() != WebWidget::FinishedLoadingState || m_queue.contains(window))
+	{
+		return;
+	}
+
+	m_queue.enqueue(window);
+
+	if (m_instance->m_updateTimer == 0)
+	{
+		m_instance->m_updateTimer = m_instance->startTimer(250, Qt::CoarseTimer);
+	}
+}
+
+void ThumbnailsManager::removeThumbnail(quint64 identifier)
+{
+	if (m_instance && m_thumbnails.remove(identifier) > 0)
+	{
+		emit m_instance->thumbnailChanged(identifier);
+	}
+}
+
+ThumbnailsManager* ThumbnailsManager::getInstance()
+{
+	return m_instance;
+}
+
+QPixmap ThumbnailsManager::getThumbnail(Window *window)
+{
+	if (!window)
+	{
+		return {};
+	}
+
+	if (!m_thumbnails.contains(window->getIdentifier()))
+	{
+		scheduleThumbnail(window);
+
+		return {};
+	}
+
+	return m_thumbnails[window->getIdentifier()];
+}
+
+}
@@ -0,0 +1,63 @@
+/**************************************************************************
+* Otter Browser: Web browser controlled by the user, not vice-versa.
+* Copyright (C) 2019 Michal Dutkiewicz aka Emdek <michal@emdek.pl>
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program. If not, see <http://www.gnu.org/licenses/>.
+*
+**************************************************************************/
+
+#ifndef OTTER_THUMBNAILSMANAGER_H
+#define OTTER_THUMBNAILSMANAGER_H
+
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QQueue>
+#include <QtGui/QPixmap>
+
+namespace Otter
+{
+
+class Window;
+
+class ThumbnailsManager final : public QObject
+{
+	Q_OBJECT
+
+public:
+	static void createInstance();
+	static void scheduleThumbnail(Window *window);
+	static void removeThumbnail(quint64 identifier);
+	static ThumbnailsManager* getInstance();
+	static QPixmap getThumbnail(Window *window);
+
+protected:
+	explicit ThumbnailsManager(QObject *parent = nullptr);
+
+	void timerEvent(QTimerEvent *event) override;
+
+private:
+	int m_updateTimer;
+
+	static ThumbnailsManager *m_instance;
+	static QQueue<QPointer<Window> > m_queue;
+	static QHash<quint64, QPixmap> m_thumbnails;
+
+signals:
+	void thumbnailChanged(quint64 identifier);
+};
+
+}
+
+#endif
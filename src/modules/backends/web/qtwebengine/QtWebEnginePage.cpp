@@ -32,7 +32,6 @@
 #include "../../../../ui/LineEditWidget.h"
 
 #include <QtCore/QFile>
-#include <QtCore/QRegularExpression>
 #include <QtWebEngineWidgets/QWebEngineHistory>
 #include <QtWebEngineWidgets/QWebEngineProfile>
 #include <QtWebEngineWidgets/QWebEngineScript>
@@ -43,6 +42,8 @@
 namespace Otter
 {
 
+QHash<QString, QString> QtWebEnginePage::m_scripts;
+
 QtWebEnginePage::QtWebEnginePage(bool isPrivate, QtWebEngineWebWidget *parent) : QWebEnginePage((isPrivate ? new QWebEngineProfile(parent) : QWebEngineProfile::defaultProfile()), parent),
 	m_widget(parent),
 	m_previousNavigationType(QtWebEnginePage::NavigationTypeOther),
@@ -165,63 +166,31 @@ void QtWebEnginePage::handleLoadFinished()
 		m_history[historyIndex] = entry;
 	}
 
-	toHtml([&](const QString &result)
+	if (m_widget)
 	{
-		if (m_widget)
-		{
-			const QUrl url(m_widget->getUrl());
-			const ContentFiltersManager::CosmeticFiltersResult cosmeticFilters(ContentFiltersManager::getCosmeticFilters(ContentFiltersManager::getProfileIdentifiers(m_widget->getOption(SettingsManager::ContentBlocking_ProfilesOption).toStringList()), url));
-
-			if (!cosmeticFilters.rules.isEmpty() || !cosmeticFilters.exceptions.isEmpty())
-			{
-				QFile file(QLatin1String(":/modules/backends/web/qtwebengine/resources/hideElements.js"));
-
-				if (file.open(QIODevice::ReadOnly))
-				{
-					runJavaScript(QString(file.readAll()).arg(createJavaScriptList(cosmeticFilters.exceptions), createJavaScriptList(cosmeticFilters.rules)));
-
-					file.close();
-				}
-			}
-
 #if QTWEBENGINECORE_VERSION >= 0x050D00
-			const QStringList blockedRequests(m_widget->getBlockedElements());
+		const QStringList blockedRequests(m_widget->getBlockedElements());
 #else
-			const QStringList blockedRequests(qobject_cast<QtWebEngineWebBackend*>(m_widget->getBackend())->getBlockedElements(url.host()));
+		const QStringList blockedRequests(qobject_cast<QtWebEngineWebBackend*>(m_widget->getBackend())->getBlockedElements(m_widget->getUrl().host()));
 #endif
 
-			if (!blockedRequests.isEmpty())
-			{
-				QFile file(QLatin1String(":/modules/backends/web/qtwebengine/resources/hideBlockedRequests.js"));
-
-				if (file.open(QIODevice::ReadOnly))
-				{
-					runJavaScript(QString(file.readAll()).arg(createJavaScriptList(blockedRequests)));
-
-					file.close();
-				}
-			}
+		if (!blockedRequests.isEmpty())
+		{
+			runJavaScript(getScriptSource(QLatin1String("hideBlockedRequests")).arg(createJavaScriptList(blockedRequests)));
 		}
+	}
 
-		QString string(url().toString());
-		string.truncate(1000);
-
-		const QRegularExpressionMatch match(QRegularExpression(QLatin1String(">(<img style=\"-webkit-user-select: none;(?: cursor: zoom-in;)?\"|<video controls=\"\" autoplay=\"\" name=\"media\"><source) src=\"") + QRegularExpression::escape(string)).match(result));
-		const bool isViewingMedia(match.hasMatch());
+	runJavaScript(QLatin1String("(function() { var type = (document.contentType || ''); var element = document.querySelector('body > img:only-child, video[name=\\'media\\'] > source'); return ((element && element.src === location.href && (type.indexOf('image/') === 0 || type.indexOf('video/') === 0 || type.indexOf('audio/') === 0)) ? element.tagName.toLowerCase() : ''); })();"), [&](const QVariant &result)
+	{
+		const QString tagName(result.toString());
+		const bool isViewingMedia(!tagName.isEmpty());
 
-		if (isViewingMedia && match.captured().startsWith(QLatin1String("><img")))
+		if (tagName == QLatin1String("img"))
 		{
 			settings()->setAttribute(QWebEngineSettings::AutoLoadImages, true);
 			settings()->setAttribute(QWebEngineSettings::JavascriptEnabled, true);
 
-			QFile file(QLatin1String(":/modules/backends/web/qtwebengine/resources/imageViewer.js"));
-
-			if (file.open(QIODevice::ReadOnly))
-			{
-				runJavaScript(file.readAll());
-
-				file.close();
-			}
+			runJavaScript(getScriptSource(QLatin1String("imageViewer")));
 		}
 
 		if (isViewingMedia != m_isViewingMedia)
@@ -354,16 +323,7 @@ QString QtWebEnginePage::createJavaScriptList(QStringList rules) const
 
 QString QtWebEnginePage::createScriptSource(const QString &path, const QStringList &parameters) const
 {
-	QFile file(QLatin1String(":/modules/backends/web/qtwebengine/resources/") + path + QLatin1String(".js"));
-
-	if (!file.open(QIODevice::ReadOnly))
-	{
-		return {};
-	}
-
-	QString script(file.readAll());
-
-	file.close();
+	QString script(getScriptSource(path));
 
 	for (int i = 0; i < parameters.count(); ++i)
 	{
@@ -579,6 +539,65 @@ bool QtWebEnginePage::acceptNavigationRequest(const QUrl &url, NavigationType ty
 		scripts().insert(script);
 	}
 
+	if (m_widget)
+	{
+		const QStringList profiles(m_widget->getOption(SettingsManager::ContentBlocking_ProfilesOption, url).toStringList());
+		const QVector<int> identifiers(ContentFiltersManager::getProfileIdentifiers(profiles));
+		const ContentFiltersManager::CosmeticFiltersResult cosmeticFilters(ContentFiltersManager::getCosmeticFilters(identifiers, url, true));
+		QStringList rules(cosmeticFilters.rules);
+
+		if (cosmeticFilters.mode == ContentFiltersManager::AllFilters)
+		{
+			QtWebEngineWebBackend *backend(qobject_cast<QtWebEngineWebBackend*>(m_widget->getBackend()));
+
+			if (!cosmeticFilters.exceptions.isEmpty())
+			{
+				rules = ContentFiltersManager::getCosmeticFilters(identifiers, url).rules;
+			}
+			else if (backend)
+			{
+				const QWebEngineScript script(backend->getCosmeticFiltersScript(profiles));
+
+				if (!script.isNull())
+				{
+					scripts().insert(script);
+				}
+			}
+		}
+
+		if (!cosmeticFilters.exceptions.isEmpty())
+		{
+			QSet<QString> exceptions;
+			exceptions.reserve(cosmeticFilters.exceptions.count());
+
+			for (int i = 0; i < cosmeticFilters.exceptions.count(); ++i)
+			{
+				exceptions.insert(cosmeticFilters.exceptions.at(i));
+			}
+
+			QStringList::iterator iterator(rules.begin());
+
+			while (iterator != rules.end())
+			{
+				if (exceptions.contains(*iterator))
+				{
+					iterator = rules.erase(iterator);
+				}
+				else
+				{
+					++iterator;
+				}
+			}
+		}
+
+		const QWebEngineScript script(QtWebEngineWebBackend::createCosmeticFiltersScript(rules));
+
+		if (!script.isNull())
+		{
+			scripts().insert(script);
+		}
+	}
+
 	emit aboutToNavigate(url, type);
 
 	return true;
@@ -658,6 +677,25 @@ bool QtWebEnginePage::javaScriptPrompt(const QUrl &url, const QString &message,
 	return dialog.isAccepted();
 }
 
+QString QtWebEnginePage::getScriptSource(const QString &path)
+{
+	if (!m_scripts.contains(path))
+	{
+		QFile file(QLatin1String(":/modules/backends/web/qtwebengine/resources/") + path + QLatin1String(".js"));
+
+		if (!file.open(QIODevice::ReadOnly))
+		{
+			return {};
+		}
+
+		m_scripts[path] = QString(file.readAll());
+
+		file.close();
+	}
+
+	return m_scripts.value(path);
+}
+
 bool QtWebEnginePage::isPopup() const
 {
 	return m_isPopup;
@@ -64,6 +64,7 @@ protected:
 	QWebEnginePage* createWindow(WebWindowType type) override;
 	QtWebEngineWebWidget* createWidget(SessionsManager::OpenHints hints);
 	QString createJavaScriptList(QStringList rules) const;
+	static QString getScriptSource(const QString &path);
 	QStringList chooseFiles(FileSelectionMode mode, const QStringList &oldFiles, const QStringList &acceptedMimeTypes) override;
 	bool acceptNavigationRequest(const QUrl &url, QWebEnginePage::NavigationType type, bool isMainFrame) override;
 	bool javaScriptConfirm(const QUrl &url, const QString &message) override;
@@ -82,6 +83,8 @@ private:
 	bool m_isViewingMedia;
 	bool m_isPopup;
 
+	static QHash<QString, QString> m_scripts;
+
 signals:
 	void requestedNewWindow(WebWidget *widget, SessionsManager::OpenHints hints, const QVariantMap &parameters);
 	void requestedPopupWindow(const QUrl &parentUrl, const QUrl &popupUrl);
@@ -32,6 +32,7 @@ namespace Otter
 #if QTWEBENGINECORE_VERSION >= 0x050D00
 QtWebEngineUrlRequestInterceptor::QtWebEngineUrlRequestInterceptor(QtWebEngineWebWidget *parent) : QWebEngineUrlRequestInterceptor(parent),
 	m_widget(parent),
+	m_blockedRequests(SettingsManager::getOption(SettingsManager::ContentBlocking_BlockedRequestsLimitOption).toInt()),
 	m_doNotTrackPolicy(NetworkManagerFactory::SkipTrackPolicy),
 	m_areImagesEnabled(true),
 	m_canSendReferrer(true)
@@ -102,9 +103,9 @@ void QtWebEngineUrlRequestInterceptor::interceptRequest(QWebEngineUrlRequestInfo
 
 			Console::addMessage(QCoreApplication::translate("main", "Request blocked by rule from profile %1:\n%2").arg(profile ? profile->getTitle() : QCoreApplication::translate("main", "(Unknown)"), result.rule), Console::NetworkCategory, Console::LogLevel, request.requestUrl().toString(), -1);
 
-			if (storeBlockedUrl && !m_blockedElements.contains(request.requestUrl().url()))
+			if (storeBlockedUrl)
 			{
-				m_blockedElements.append(request.requestUrl().url());
+				m_blockedRequests.addElement(request.requestUrl().url());
 			}
 
 			NetworkManager::ResourceInformation resource;
@@ -113,9 +114,9 @@ void QtWebEngineUrlRequestInterceptor::interceptRequest(QWebEngineUrlRequestInfo
 			resource.metaData[NetworkManager::ContentBlockingProfileMetaData] = result.profile;
 			resource.metaData[NetworkManager::ContentBlockingRuleMetaData] = result.rule;
 
-			m_blockedRequests.append(resource);
+			m_blockedRequests.addRequest(resource);
 
-			emit pageInformationChanged(WebWidget::RequestsBlockedInformation, m_blockedRequests.count());
+			emit pageInformationChanged(WebWidget::RequestsBlockedInformation, m_blockedRequests.getAmount());
 			emit requestBlocked(resource);
 
 			request.block(true);
@@ -142,7 +143,8 @@ void QtWebEngineUrlRequestInterceptor::interceptRequest(QWebEngineUrlRequestInfo
 void QtWebEngineUrlRequestInterceptor::resetStatistics()
 {
 	m_blockedRequests.clear();
-	m_blockedElements.clear();
+	m_blockedRequests.setLimit(SettingsManager::getOption(SettingsManager::ContentBlocking_BlockedRequestsLimitOption).toInt());
+
 	m_startedRequestsAmount = 0;
 }
 
@@ -188,7 +190,7 @@ QVariant QtWebEngineUrlRequestInterceptor::getPageInformation(WebWidget::PageInf
 	switch (key)
 	{
 		case WebWidget::RequestsBlockedInformation:
-			return m_blockedRequests.count();
+			return m_blockedRequests.getAmount();
 
 		case WebWidget::RequestsStartedInformation:
 			return m_startedRequestsAmount;
@@ -201,12 +203,17 @@ QVariant QtWebEngineUrlRequestInterceptor::getPageInformation(WebWidget::PageInf
 
 QStringList QtWebEngineUrlRequestInterceptor::getBlockedElements() const
 {
-	return m_blockedElements;
+	return m_blockedRequests.getElements();
+}
+
+QVector<NetworkManager::ResourceInformation> QtWebEngineUrlRequestInterceptor::getBlockedRequests(int from, int amount) const
+{
+	return m_blockedRequests.getRequests(from, amount);
 }
 
-QVector<NetworkManager::ResourceInformation> QtWebEngineUrlRequestInterceptor::getBlockedRequests() const
+int QtWebEngineUrlRequestInterceptor::getBlockedRequestsAmount(int profile) const
 {
-	return m_blockedRequests;
+	return ((profile < 0) ? m_blockedRequests.getAmount() : m_blockedRequests.getProfileAmount(profile));
 }
 #else
 QtWebEngineUrlRequestInterceptor::QtWebEngineUrlRequestInterceptor(QObject *parent) : QWebEngineUrlRequestInterceptor(parent),
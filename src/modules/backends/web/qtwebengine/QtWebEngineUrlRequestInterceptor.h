@@ -22,6 +22,7 @@
 #define OTTER_QTWEBENGINEURLREQUESTINTERCEPTOR_H
 
 #include "QtWebEngineWebWidget.h"
+#include "../../../../core/BlockedRequestsLog.h"
 #include "../../../../core/NetworkManager.h"
 #include "../../../../core/NetworkManagerFactory.h"
 
@@ -45,7 +46,8 @@ public:
 
 	void interceptRequest(QWebEngineUrlRequestInfo &request) override;
 	QStringList getBlockedElements() const;
-	QVector<NetworkManager::ResourceInformation> getBlockedRequests() const;
+	QVector<NetworkManager::ResourceInformation> getBlockedRequests(int from = 0, int amount = -1) const;
+	int getBlockedRequestsAmount(int profile = -1) const;
 
 protected:
 	void updateOptions(const QUrl &url);
@@ -57,9 +59,8 @@ protected slots:
 
 private:
 	QtWebEngineWebWidget *m_widget;
-	QStringList m_blockedElements;
+	BlockedRequestsLog m_blockedRequests;
 	QStringList m_unblockedHosts;
-	QVector<NetworkManager::ResourceInformation> m_blockedRequests;
 	QVector<int> m_contentBlockingProfiles;
 	NetworkManagerFactory::DoNotTrackPolicy m_doNotTrackPolicy;
 	quint64 m_startedRequestsAmount;
@@ -36,6 +36,7 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 #include <QtCore/QRegularExpression>
 #include <QtWebEngineWidgets/QWebEngineProfile>
 #include <QtWebEngineWidgets/QWebEngineSettings>
@@ -145,6 +146,11 @@ void QtWebEngineWebBackend::handleOptionChanged(int identifier)
 {
 	switch (identifier)
 	{
+		case SettingsManager::ContentBlocking_CosmeticFiltersModeOption:
+		case SettingsManager::ContentBlocking_EnableWildcardsOption:
+			m_cosmeticFiltersScripts.clear();
+
+			return;
 		case SettingsManager::Browser_PrintElementBackgroundsOption:
 			QWebEngineSettings::globalSettings()->setAttribute(QWebEngineSettings::PrintElementBackgrounds, SettingsManager::getOption(SettingsManager::Browser_PrintElementBackgroundsOption).toBool());
 
@@ -270,12 +276,49 @@ WebWidget* QtWebEngineWebBackend::createWidget(const QVariantMap &parameters, Co
 		handleOptionChanged(SettingsManager::Permissions_EnableFullScreenOption);
 
 		connect(SettingsManager::getInstance(), &SettingsManager::optionChanged, this, &QtWebEngineWebBackend::handleOptionChanged);
+		connect(ContentFiltersManager::getInstance(), &ContentFiltersManager::profileModified, this, [&]()
+		{
+			m_cosmeticFiltersScripts.clear();
+		});
 		connect(QWebEngineProfile::defaultProfile(), &QWebEngineProfile::downloadRequested, this, &QtWebEngineWebBackend::handleDownloadRequested);
 	}
 
 	return new QtWebEngineWebWidget(parameters, this, parent);
 }
 
+QWebEngineScript QtWebEngineWebBackend::createCosmeticFiltersScript(const QStringList &rules)
+{
+	if (rules.isEmpty())
+	{
+		return {};
+	}
+
+	QFile file(QLatin1String(":/modules/backends/web/qtwebengine/resources/hideElements.js"));
+
+	if (!file.open(QIODevice::ReadOnly))
+	{
+		return {};
+	}
+
+	QStringList escapedRules(rules);
+
+	for (int i = 0; i < escapedRules.count(); ++i)
+	{
+		escapedRules[i] = escapedRules[i].replace(QLatin1Char('\\'), QLatin1String("\\\\")).replace(QLatin1Char('\''), QLatin1String("\\'"));
+	}
+
+	QWebEngineScript script;
+	script.setName(QLatin1String("otter-cosmetic-filters"));
+	script.setInjectionPoint(QWebEngineScript::DocumentCreation);
+	script.setRunsOnSubFrames(false);
+	script.setWorldId(QWebEngineScript::UserWorld);
+	script.setSourceCode(QString(file.readAll()).arg(QLatin1Char('\'') + escapedRules.join(QLatin1String("','")) + QLatin1Char('\'')));
+
+	file.close();
+
+	return script;
+}
+
 QString QtWebEngineWebBackend::getName() const
 {
 	return QLatin1String("qtwebengine");
@@ -339,6 +382,33 @@ QUrl QtWebEngineWebBackend::getHomePage() const
 	return QUrl(QLatin1String("https://otter-browser.org/"));
 }
 
+QWebEngineScript QtWebEngineWebBackend::getCosmeticFiltersScript(const QStringList &profiles)
+{
+	const QString key(profiles.join(QLatin1Char(',')));
+
+	if (!m_cosmeticFiltersScripts.contains(key))
+	{
+		const QVector<int> identifiers(ContentFiltersManager::getProfileIdentifiers(profiles));
+		QStringList rules;
+
+		for (int i = 0; i < identifiers.count(); ++i)
+		{
+			ContentFiltersProfile *profile(ContentFiltersManager::getProfile(identifiers.at(i)));
+
+			if (profile)
+			{
+				rules.append(profile->getCosmeticFilters({}, false).rules);
+			}
+		}
+
+		rules.removeDuplicates();
+
+		m_cosmeticFiltersScripts[key] = createCosmeticFiltersScript(rules);
+	}
+
+	return m_cosmeticFiltersScripts.value(key);
+}
+
 WebBackend::BackendCapabilities QtWebEngineWebBackend::getCapabilities() const
 {
 	return (UserScriptsCapability | GlobalCookiesPolicyCapability | GlobalContentFilteringCapability | GlobalDoNotTrackCapability | GlobalProxyCapability | GlobalReferrerCapability | GlobalUserAgentCapability);
@@ -28,6 +28,7 @@
 #include <QtWebEngineCore/QWebEngineNotification>
 #endif
 #include <QtWebEngineWidgets/QWebEngineDownloadItem>
+#include <QtWebEngineWidgets/QWebEngineScript>
 
 #include <memory>
 
@@ -45,6 +46,7 @@ public:
 	explicit QtWebEngineWebBackend(QObject *parent = nullptr);
 
 	WebWidget* createWidget(const QVariantMap &parameters, ContentsWidget *parent = nullptr) override;
+	static QWebEngineScript createCosmeticFiltersScript(const QStringList &rules);
 	QString getName() const override;
 	QString getTitle() const override;
 	QString getDescription() const override;
@@ -56,6 +58,7 @@ public:
 	QStringList getBlockedElements(const QString &domain) const;
 #endif
 	QUrl getHomePage() const override;
+	QWebEngineScript getCosmeticFiltersScript(const QStringList &profiles);
 	WebBackend::BackendCapabilities getCapabilities() const override;
 
 #if QTWEBENGINECORE_VERSION >= 0x050D00
@@ -71,6 +74,7 @@ private:
 #if QTWEBENGINECORE_VERSION < 0x050D00
 	QtWebEngineUrlRequestInterceptor *m_requestInterceptor;
 #endif
+	QHash<QString, QWebEngineScript> m_cosmeticFiltersScripts;
 	bool m_isInitialized;
 
 	static QString m_engineVersion;
@@ -30,6 +30,7 @@
 #include "../../../../core/NetworkManagerFactory.h"
 #include "../../../../core/NotesManager.h"
 #include "../../../../core/SearchEnginesManager.h"
+#include "../../../../core/SessionsManager.h"
 #include "../../../../core/ThemesManager.h"
 #include "../../../../core/TransfersManager.h"
 #include "../../../../core/UserScript.h"
@@ -54,6 +55,9 @@
 #include <QtGui/QImageWriter>
 #include <QtPrintSupport/QPrintPreviewDialog>
 #include <QtWebEngineCore/QWebEngineCookieStore>
+#if QTWEBENGINECORE_VERSION >= 0x050E00
+#include <QtWebEngineCore/QWebEngineFindTextResult>
+#endif
 #include <QtWebEngineWidgets/QWebEngineHistory>
 #include <QtWebEngineWidgets/QWebEngineProfile>
 #include <QtWebEngineWidgets/QWebEngineScript>
@@ -74,6 +78,10 @@ QtWebEngineWebWidget::QtWebEngineWebWidget(const QVariantMap &parameters, WebBac
 	m_loadingState(FinishedLoadingState),
 	m_canGoForwardValue(UnknownValue),
 	m_documentLoadingProgress(0),
+#if QTWEBENGINECORE_VERSION >= 0x050E00
+	m_findInPageRequest(0),
+	m_findInPageFinishedRequest(0),
+#endif
 	m_focusProxyTimer(0),
 	m_updateNavigationActionsTimer(0),
 	m_isEditing(false),
@@ -95,6 +103,10 @@ QtWebEngineWebWidget::QtWebEngineWebWidget(const QVariantMap &parameters, WebBac
 	connect(m_page, &QtWebEnginePage::loadStarted, this, &QtWebEngineWebWidget::handleLoadStarted);
 	connect(m_page, &QtWebEnginePage::loadFinished, this, &QtWebEngineWebWidget::handleLoadFinished);
 	connect(m_page, &QtWebEnginePage::linkHovered, this, &QtWebEngineWebWidget::setStatusMessageOverride);
+	connect(m_page, &QtWebEnginePage::scrollPositionChanged, this, [&]()
+	{
+		SessionsManager::markSessionAsModified(getWindowIdentifier());
+	});
 	connect(m_page, &QtWebEnginePage::iconChanged, this, &QtWebEngineWebWidget::notifyIconChanged);
 	connect(m_page, &QtWebEnginePage::requestedPopupWindow, this, &QtWebEngineWebWidget::requestedPopupWindow);
 	connect(m_page, &QtWebEnginePage::aboutToNavigate, this, &QtWebEngineWebWidget::aboutToNavigate);
@@ -114,6 +126,20 @@ QtWebEngineWebWidget::QtWebEngineWebWidget(const QVariantMap &parameters, WebBac
 	});
 	connect(m_page, &QtWebEnginePage::recentlyAudibleChanged, this, &QtWebEngineWebWidget::isAudibleChanged);
 	connect(m_page, &QtWebEnginePage::viewingMediaChanged, this, &QtWebEngineWebWidget::notifyNavigationActionsChanged);
+#if QTWEBENGINECORE_VERSION >= 0x050E00
+	connect(m_page, &QtWebEnginePage::findTextFinished, this, [&](const QWebEngineFindTextResult &result)
+	{
+		const int matchesAmount(result.numberOfMatches());
+
+		QTimer::singleShot(0, this, [=]()
+		{
+			if (!m_findInPageQuery.isEmpty() && m_findInPageFinishedRequest == m_findInPageRequest)
+			{
+				emit findInPageResultsChanged(m_findInPageQuery, matchesAmount);
+			}
+		});
+	});
+#endif
 	connect(m_page, &QtWebEnginePage::titleChanged, this, &QtWebEngineWebWidget::notifyTitleChanged);
 	connect(m_page, &QtWebEnginePage::urlChanged, this, &QtWebEngineWebWidget::notifyUrlChanged);
 	connect(m_page, &QtWebEnginePage::renderProcessTerminated, this, &QtWebEngineWebWidget::notifyRenderProcessTerminated);
@@ -223,16 +249,57 @@ void QtWebEngineWebWidget::search(const QString &query, const QString &searchEng
 	}
 }
 
-void QtWebEngineWebWidget::print(QPrinter *printer)
+void QtWebEngineWebWidget::print(QPrinter *printer, const std::function<void(bool)> &callback)
 {
-	QEventLoop eventLoop;
+	m_page->print(printer, callback);
+}
 
-	m_page->print(printer, [&](bool)
+void QtWebEngineWebWidget::findInPage(const QString &text, FindFlags flags)
+{
+	m_findInPageQuery = text;
+#if QTWEBENGINECORE_VERSION >= 0x050E00
+	++m_findInPageRequest;
+#endif
+
+	if (text.isEmpty())
 	{
-		eventLoop.quit();
-	});
+		m_page->findText(text);
+
+		emit findInPageResultsChanged(text, 0);
+
+		return;
+	}
+
+	QWebEnginePage::FindFlags nativeFlags;
+
+	if (flags.testFlag(BackwardFind))
+	{
+		nativeFlags |= QWebEnginePage::FindBackward;
+	}
+
+	if (flags.testFlag(CaseSensitiveFind))
+	{
+		nativeFlags |= QWebEnginePage::FindCaseSensitively;
+	}
+
+#if QTWEBENGINECORE_VERSION >= 0x050E00
+	const int request(m_findInPageRequest);
+
+	m_page->findText(text, nativeFlags, [=](const QVariant &result)
+	{
+		Q_UNUSED(result)
 
-	eventLoop.exec();
+		m_findInPageFinishedRequest = request;
+	});
+#else
+	m_page->findText(text, nativeFlags, [=](const QVariant &result)
+	{
+		if (text == m_findInPageQuery)
+		{
+			emit findInPageResultsChanged(text, (result.toBool() ? -1 : 0));
+		}
+	});
+#endif
 }
 
 void QtWebEngineWebWidget::clearOptions()
@@ -1054,7 +1121,7 @@ void QtWebEngineWebWidget::notifyUrlChanged()
 	emit urlChanged((url.toString() == QLatin1String("about:blank")) ? m_page->requestedUrl() : url);
 	emit categorizedActionsStateChanged({ActionsManager::ActionDefinition::PageCategory});
 
-	SessionsManager::markSessionAsModified();
+	SessionsManager::markSessionAsModified(getWindowIdentifier());
 }
 
 void QtWebEngineWebWidget::notifyIconChanged()
@@ -1288,7 +1355,7 @@ void QtWebEngineWebWidget::setZoom(int zoom)
 	{
 		m_page->setZoomFactor(qBound(0.1, (static_cast<qreal>(zoom) / 100), static_cast<qreal>(100)));
 
-		SessionsManager::markSessionAsModified();
+		SessionsManager::markSessionAsModified(getWindowIdentifier());
 
 		emit zoomChanged(zoom);
 		emit geometryChanged();
@@ -1709,9 +1776,9 @@ QVector<WebWidget::LinkUrl> QtWebEngineWebWidget::getSearchEngines() const
 }
 
 #if QTWEBENGINECORE_VERSION >= 0x050D00
-QVector<NetworkManager::ResourceInformation> QtWebEngineWebWidget::getBlockedRequests() const
+QVector<NetworkManager::ResourceInformation> QtWebEngineWebWidget::getBlockedRequests(int from, int amount) const
 {
-	return m_requestInterceptor->getBlockedRequests();
+	return m_requestInterceptor->getBlockedRequests(from, amount);
 }
 #endif
 
@@ -1725,48 +1792,16 @@ WebWidget::LoadingState QtWebEngineWebWidget::getLoadingState() const
 	return m_loadingState;
 }
 
-int QtWebEngineWebWidget::getZoom() const
+#if QTWEBENGINECORE_VERSION >= 0x050D00
+int QtWebEngineWebWidget::getBlockedRequestsAmount(int profile) const
 {
-	return static_cast<int>(m_page->zoomFactor() * 100);
+	return m_requestInterceptor->getBlockedRequestsAmount(profile);
 }
+#endif
 
-int QtWebEngineWebWidget::findInPage(const QString &text, FindFlags flags)
+int QtWebEngineWebWidget::getZoom() const
 {
-	if (text.isEmpty())
-	{
-		m_page->findText(text);
-
-		return 0;
-	}
-
-	QWebEnginePage::FindFlags nativeFlags;
-
-	if (flags.testFlag(BackwardFind))
-	{
-		nativeFlags |= QWebEnginePage::FindBackward;
-	}
-
-	if (flags.testFlag(CaseSensitiveFind))
-	{
-		nativeFlags |= QWebEnginePage::FindCaseSensitively;
-	}
-
-	QEventLoop eventLoop;
-	bool hasMatch(false);
-
-	m_page->findText(text, nativeFlags, [&](const QVariant &result)
-	{
-		hasMatch = result.toBool();
-
-		eventLoop.quit();
-	});
-
-	connect(this, &QtWebEngineWebWidget::aboutToReload, &eventLoop, &QEventLoop::quit);
-	connect(this, &QtWebEngineWebWidget::destroyed, &eventLoop, &QEventLoop::quit);
-
-	eventLoop.exec();
-
-	return (hasMatch ? -1 : 0);
+	return static_cast<int>(m_page->zoomFactor() * 100);
 }
 
 bool QtWebEngineWebWidget::canGoBack() const
@@ -63,7 +63,8 @@ public:
 	};
 
 	void search(const QString &query, const QString &searchEngine) override;
-	void print(QPrinter *printer) override;
+	void print(QPrinter *printer, const std::function<void(bool)> &callback) override;
+	void findInPage(const QString &text, FindFlags flags = NoFlagsFind) override;
 	WebWidget* clone(bool cloneHistory = true, bool isPrivate = false, const QStringList &excludedOptions = {}) const override;
 	QWidget* getInspector() override;
 	QWidget* getViewport() override;
@@ -87,12 +88,14 @@ public:
 	QVector<LinkUrl> getLinks() const override;
 	QVector<LinkUrl> getSearchEngines() const override;
 #if QTWEBENGINECORE_VERSION >= 0x050D00
-	QVector<NetworkManager::ResourceInformation> getBlockedRequests() const override;
+	QVector<NetworkManager::ResourceInformation> getBlockedRequests(int from = 0, int amount = -1) const override;
 #endif
 	QMultiMap<QString, QString> getMetaData() const override;
 	LoadingState getLoadingState() const override;
+#if QTWEBENGINECORE_VERSION >= 0x050D00
+	int getBlockedRequestsAmount(int profile = -1) const override;
+#endif
 	int getZoom() const override;
-	int findInPage(const QString &text, FindFlags flags = NoFlagsFind) override;
 	bool hasSelection() const override;
 	bool hasWatchedChanges(ChangeWatcher watcher) const override;
 	bool isAudible() const override;
@@ -167,6 +170,7 @@ private:
 #if QTWEBENGINECORE_VERSION >= 0x050D00
 	QtWebEngineUrlRequestInterceptor *m_requestInterceptor;
 #endif
+	QString m_findInPageQuery;
 	QDateTime m_lastUrlClickTime;
 	QPixmap m_thumbnail;
 	HitTestResult m_hitResult;
@@ -180,6 +184,10 @@ private:
 	LoadingState m_loadingState;
 	TrileanValue m_canGoForwardValue;
 	int m_documentLoadingProgress;
+#if QTWEBENGINECORE_VERSION >= 0x050E00
+	int m_findInPageRequest;
+	int m_findInPageFinishedRequest;
+#endif
 	int m_focusProxyTimer;
 	int m_updateNavigationActionsTimer;
 	bool m_isEditing;
@@ -1,41 +1,27 @@
-var whitelist = [%1];
-var blacklist = [%2];
-var ignoredElements = [];
-
-for (var i = 0; i < whitelist.length; ++i)
+(function()
 {
-	try
-	{
-		ignoredElements = ignoredElements.concat(Array.from(document.querySelectorAll(whitelist[i])));
-	}
-	catch (e)
+	var rules = [%1];
+	var styleSheet = document.createElement('style');
+	styleSheet.textContent = rules.map(function(rule)
 	{
-		console.error("Invalid selector: " + whitelist[i]);
+		return (rule + ' {display:none !important;}');
+	}).join('\n');
 
-		continue;
-	}
-}
-
-for (var i = 0; i < blacklist.length; ++i)
-{
-	var elements = [];
-
-	try
-	{
-		elements = document.querySelectorAll(blacklist[i]);
-	}
-	catch (e)
+	if (document.documentElement)
 	{
-		console.error("Invalid selector: " + blacklist[i]);
+		document.documentElement.appendChild(styleSheet);
 
-		continue;
+		return;
 	}
 
-	for (var j = 0; j < elements.length; ++j)
+	var observer = new MutationObserver(function()
 	{
-		if (ignoredElements.indexOf(elements[j]) < 0)
+		if (document.documentElement)
 		{
-			elements[j].style.cssText = "display:none !important";
+			observer.disconnect();
+
+			document.documentElement.appendChild(styleSheet);
 		}
-	}
-}
+	});
+	observer.observe(document, {childList: true});
+})();
@@ -23,26 +23,83 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QMimeDatabase>
+#include <QtCore/QTimer>
+#include <QtCore/QTimerEvent>
 
 namespace Otter
 {
 
+QHash<QString, QFtp*> QtWebKitFtpListingNetworkReply::m_connections;
+
 QtWebKitFtpListingNetworkReply::QtWebKitFtpListingNetworkReply(const QNetworkRequest &request, QObject *parent) : ListingNetworkReply(request, parent),
-	m_ftp(new QFtp(this)),
-	m_offset(0)
+	m_ftp(nullptr),
+	m_offset(0),
+	m_flushTimer(0),
+	m_isListing(false),
+	m_isReusingConnection(false)
 {
-	connect(m_ftp, &QFtp::listInfo, this, &QtWebKitFtpListingNetworkReply::addEntry);
-	connect(m_ftp, &QFtp::readyRead, this, &QtWebKitFtpListingNetworkReply::processData);
-	connect(m_ftp, &QFtp::commandFinished, this, &QtWebKitFtpListingNetworkReply::processCommand);
-	connect(m_ftp, &QFtp::dataTransferProgress, this, &QtWebKitFtpListingNetworkReply::downloadProgress);
+	QFtp *ftp(takeConnection(request.url().host()));
 
-	m_ftp->connectToHost(request.url().host());
+	if (ftp)
+	{
+		m_isReusingConnection = true;
+
+		setConnection(ftp);
+
+		m_ftp->list(Utils::normalizeUrl(request.url()).path());
+	}
+	else
+	{
+		setConnection(new QFtp());
+
+		m_ftp->connectToHost(request.url().host());
+	}
+}
+
+void QtWebKitFtpListingNetworkReply::timerEvent(QTimerEvent *event)
+{
+	if (event->timerId() == m_flushTimer)
+	{
+		flushEntries();
+	}
 }
 
 void QtWebKitFtpListingNetworkReply::processCommand(int command, bool isError)
 {
 	Q_UNUSED(command)
 
+	if (isError && m_isReusingConnection && !m_isListing && m_content.isEmpty())
+	{
+		m_isReusingConnection = false;
+		m_heldEntries.clear();
+
+		disconnect(m_ftp, nullptr, this, nullptr);
+
+		m_ftp->deleteLater();
+
+		setConnection(new QFtp());
+
+		m_ftp->connectToHost(request().url().host());
+
+		return;
+	}
+
+	if (isError && m_isListing)
+	{
+		flushEntries();
+		appendContent(createListingError(m_ftp->errorString()) + createListingFooter());
+		setFinished(true);
+
+		emit finished();
+
+		if (m_ftp->error() != QFtp::NotConnected)
+		{
+			m_ftp->close();
+		}
+
+		return;
+	}
+
 	if (isError)
 	{
 		open(ReadOnly | Unbuffered);
@@ -70,10 +127,21 @@ void QtWebKitFtpListingNetworkReply::processCommand(int command, bool isError)
 			information.title = tr("Network error %1").arg(m_ftp->replyCode());
 		}
 
+		if (m_flushTimer != 0)
+		{
+			killTimer(m_flushTimer);
+
+			m_flushTimer = 0;
+		}
+
 		m_content = Utils::createErrorPage(information).toUtf8();
+		m_offset = 0;
+
+		m_pendingEntries.clear();
 
 		setHeader(QNetworkRequest::ContentTypeHeader, QVariant(QLatin1String("text/html; charset=UTF-8")));
 		setHeader(QNetworkRequest::ContentLengthHeader, QVariant(m_content.size()));
+		setFinished(true);
 
 		emit listingError();
 		emit readyRead();
@@ -102,91 +170,38 @@ void QtWebKitFtpListingNetworkReply::processCommand(int command, bool isError)
 
 			break;
 		case QFtp::List:
-			if (m_directories.isEmpty() && ((m_files.count() == 1 && m_symlinks.isEmpty() && request().url().path().endsWith(m_files.first().name())) || (m_symlinks.count() == 1 && m_files.isEmpty() && request().url().path().endsWith(m_symlinks.first().name()))))
+			if (!m_isListing && m_heldEntries.count() == 1)
 			{
+				m_heldEntries.clear();
+
 				m_ftp->get(Utils::normalizeUrl(request().url()).path());
 			}
 			else
 			{
-				open(ReadOnly | Unbuffered);
-
-				QUrl url(request().url());
-				QMimeDatabase mimeDatabase;
-				QVector<ListingEntry> entries;
-				QVector<NavigationEntry> navigation;
-				const QVector<QUrlInfo> rawEntries(m_symlinks + m_directories + m_files);
-
-				if (url.path().isEmpty())
+				if (!m_isListing)
 				{
-					url.setPath(QLatin1String("/"));
+					startListing();
 				}
 
-				while (true)
-				{
-					const bool isRoot(url.path() == QLatin1String("/"));
+				flushEntries();
+				appendContent(createListingFooter());
+				setFinished(true);
 
-					url = url.adjusted(QUrl::StripTrailingSlash);
-
-					NavigationEntry entry;
-					entry.name = (isRoot ? url.toString() : url.fileName() + QLatin1Char('/'));
-					entry.url = url.url();
-
-					navigation.prepend(entry);
-
-					if (isRoot)
-					{
-						break;
-					}
-
-					url = url.adjusted(QUrl::RemoveFilename);
-				}
-
-				for (int i = 0; i < rawEntries.count(); ++i)
-				{
-					ListingEntry entry;
-					entry.name = rawEntries.at(i).name();
-					entry.url = Utils::normalizeUrl(request().url()).url() + QLatin1Char('/') + rawEntries.at(i).name();
-					entry.timeModified = rawEntries.at(i).lastModified();
-					entry.type = (rawEntries.at(i).isSymLink() ? ListingEntry::UnknownType : (rawEntries.at(i).isDir() ? ListingEntry::DirectoryType : ListingEntry::FileType));
-					entry.size = rawEntries.at(i).size();
-					entry.isSymlink = rawEntries.at(i).isSymLink();
-
-					if (rawEntries.at(i).isSymLink())
-					{
-						entry.mimeType = mimeDatabase.mimeTypeForName(QLatin1String("text/uri-list"));
-					}
-					else if (rawEntries.at(i).isDir())
-					{
-						entry.mimeType = mimeDatabase.mimeTypeForName(QLatin1String("inode/directory"));
-					}
-					else
-					{
-						entry.mimeType = mimeDatabase.mimeTypeForUrl(request().url().url() + rawEntries.at(i).name());
-					}
-
-					entries.append(entry);
-				}
-
-				m_content = createListing(request().url().toString() + (request().url().path().endsWith(QLatin1Char('/')) ? QChar() : QLatin1Char('/')), navigation, entries);
-
-				setHeader(QNetworkRequest::ContentTypeHeader, QVariant(QLatin1String("text/html; charset=UTF-8")));
-				setHeader(QNetworkRequest::ContentLengthHeader, QVariant(m_content.size()));
-
-				emit readyRead();
 				emit finished();
 
-				m_ftp->close();
+				releaseConnection();
 			}
 
 			break;
 		case QFtp::Get:
 			open(QIODevice::ReadOnly | QIODevice::Unbuffered);
 			setHeader(QNetworkRequest::ContentLengthHeader, QVariant(m_content.size()));
+			setFinished(true);
 
 			emit readyRead();
 			emit finished();
 
-			m_ftp->close();
+			releaseConnection();
 
 			break;
 		default:
@@ -196,34 +211,224 @@ void QtWebKitFtpListingNetworkReply::processCommand(int command, bool isError)
 
 void QtWebKitFtpListingNetworkReply::addEntry(const QUrlInfo &entry)
 {
-	if (entry.isSymLink())
+	if (m_isListing)
 	{
-		m_symlinks.append(entry);
+		m_pendingEntries.append(createEntry(entry));
+
+		if (m_pendingEntries.count() >= 500)
+		{
+			flushEntries();
+		}
+		else if (m_flushTimer == 0)
+		{
+			m_flushTimer = startTimer(100);
+		}
+
+		return;
 	}
-	else if (entry.isDir())
+
+	m_heldEntries.append(entry);
+
+	if (m_heldEntries.count() > 1 || entry.isDir() || !request().url().path().endsWith(entry.name()))
 	{
-		m_directories.append(entry);
+		startListing();
 	}
-	else
+}
+
+void QtWebKitFtpListingNetworkReply::processData()
+{
+	appendContent(m_ftp->readAll());
+}
+
+void QtWebKitFtpListingNetworkReply::startListing()
+{
+	open(ReadOnly | Unbuffered);
+
+	QUrl url(request().url());
+	QVector<NavigationEntry> navigation;
+
+	if (url.path().isEmpty())
+	{
+		url.setPath(QLatin1String("/"));
+	}
+
+	while (true)
+	{
+		const bool isRoot(url.path() == QLatin1String("/"));
+
+		url = url.adjusted(QUrl::StripTrailingSlash);
+
+		NavigationEntry entry;
+		entry.name = (isRoot ? url.toString() : url.fileName() + QLatin1Char('/'));
+		entry.url = url.url();
+
+		navigation.prepend(entry);
+
+		if (isRoot)
+		{
+			break;
+		}
+
+		url = url.adjusted(QUrl::RemoveFilename);
+	}
+
+	for (int i = 0; i < m_heldEntries.count(); ++i)
 	{
-		m_files.append(entry);
+		m_pendingEntries.append(createEntry(m_heldEntries.at(i)));
 	}
+
+	m_heldEntries.clear();
+
+	m_isListing = true;
+
+	setHeader(QNetworkRequest::ContentTypeHeader, QVariant(QLatin1String("text/html; charset=UTF-8")));
+	appendContent(createListingHeader(request().url().toString() + (request().url().path().endsWith(QLatin1Char('/')) ? QChar() : QLatin1Char('/')), navigation));
+	flushEntries();
 }
 
-void QtWebKitFtpListingNetworkReply::processData()
+void QtWebKitFtpListingNetworkReply::flushEntries()
+{
+	if (m_flushTimer != 0)
+	{
+		killTimer(m_flushTimer);
+
+		m_flushTimer = 0;
+	}
+
+	if (!m_pendingEntries.isEmpty())
+	{
+		appendContent(createListingEntries(m_pendingEntries));
+
+		m_pendingEntries.clear();
+	}
+}
+
+void QtWebKitFtpListingNetworkReply::appendContent(const QByteArray &content)
 {
-	m_content += m_ftp->readAll();
+	if (m_offset >= m_content.size())
+	{
+		m_content = content;
+		m_offset = 0;
+	}
+	else
+	{
+		m_content.append(content);
+	}
 
 	emit readyRead();
 }
 
+void QtWebKitFtpListingNetworkReply::releaseConnection()
+{
+	QFtp *ftp(m_ftp);
+	const QString host(request().url().host());
+
+	disconnect(ftp, nullptr, this, nullptr);
+
+	if (ftp->state() != QFtp::LoggedIn || m_connections.contains(host))
+	{
+		ftp->close();
+
+		return;
+	}
+
+	m_ftp = nullptr;
+
+	ftp->setParent(QCoreApplication::instance());
+
+	m_connections[host] = ftp;
+
+	QTimer *idleTimer(new QTimer(ftp));
+	idleTimer->setObjectName(QLatin1String("idleTimer"));
+	idleTimer->setSingleShot(true);
+	idleTimer->start(60000);
+
+	connect(idleTimer, &QTimer::timeout, ftp, &QFtp::close);
+	connect(ftp, &QFtp::stateChanged, ftp, [=](int state)
+	{
+		if (state == QFtp::Unconnected)
+		{
+			if (m_connections.value(host) == ftp)
+			{
+				m_connections.remove(host);
+			}
+
+			ftp->deleteLater();
+		}
+	});
+}
+
 void QtWebKitFtpListingNetworkReply::abort()
 {
-	m_ftp->close();
+	if (m_ftp)
+	{
+		m_ftp->close();
+	}
+
+	setFinished(true);
 
 	emit finished();
 }
 
+void QtWebKitFtpListingNetworkReply::setConnection(QFtp *ftp)
+{
+	m_ftp = ftp;
+	m_ftp->setParent(this);
+
+	connect(m_ftp, &QFtp::listInfo, this, &QtWebKitFtpListingNetworkReply::addEntry);
+	connect(m_ftp, &QFtp::readyRead, this, &QtWebKitFtpListingNetworkReply::processData);
+	connect(m_ftp, &QFtp::commandFinished, this, &QtWebKitFtpListingNetworkReply::processCommand);
+	connect(m_ftp, &QFtp::dataTransferProgress, this, &QtWebKitFtpListingNetworkReply::downloadProgress);
+}
+
+QFtp* QtWebKitFtpListingNetworkReply::takeConnection(const QString &host)
+{
+	QFtp *ftp(m_connections.take(host));
+
+	if (ftp)
+	{
+		ftp->disconnect(ftp);
+
+		delete ftp->findChild<QTimer*>(QLatin1String("idleTimer"), Qt::FindDirectChildrenOnly);
+
+		if (ftp->state() != QFtp::LoggedIn)
+		{
+			ftp->deleteLater();
+
+			return nullptr;
+		}
+	}
+
+	return ftp;
+}
+
+QtWebKitFtpListingNetworkReply::ListingEntry QtWebKitFtpListingNetworkReply::createEntry(const QUrlInfo &rawEntry) const
+{
+	const QMimeDatabase mimeDatabase;
+	ListingEntry entry;
+	entry.name = rawEntry.name();
+	entry.url = Utils::normalizeUrl(request().url()).url() + QLatin1Char('/') + rawEntry.name();
+	entry.timeModified = rawEntry.lastModified();
+	entry.type = (rawEntry.isSymLink() ? ListingEntry::UnknownType : (rawEntry.isDir() ? ListingEntry::DirectoryType : ListingEntry::FileType));
+	entry.size = rawEntry.size();
+	entry.isSymlink = rawEntry.isSymLink();
+
+	if (rawEntry.isSymLink())
+	{
+		entry.mimeType = mimeDatabase.mimeTypeForName(QLatin1String("text/uri-list"));
+	}
+	else if (rawEntry.isDir())
+	{
+		entry.mimeType = mimeDatabase.mimeTypeForName(QLatin1String("inode/directory"));
+	}
+	else
+	{
+		entry.mimeType = mimeDatabase.mimeTypeForUrl(request().url().url() + rawEntry.name());
+	}
+
+	return entry;
+}
+
 qint64 QtWebKitFtpListingNetworkReply::bytesAvailable() const
 {
 	return (m_content.size() - m_offset);
@@ -242,7 +447,7 @@ qint64 QtWebKitFtpListingNetworkReply::readData(char *data, qint64 maxSize)
 		return number;
 	}
 
-	return -1;
+	return (isFinished() ? -1 : 0);
 }
 
 bool QtWebKitFtpListingNetworkReply::isSequential() const
@@ -42,6 +42,16 @@ public:
 public slots:
 	void abort() override;
 
+protected:
+	void timerEvent(QTimerEvent *event) override;
+	void startListing();
+	void flushEntries();
+	void appendContent(const QByteArray &content);
+	void releaseConnection();
+	void setConnection(QFtp *ftp);
+	ListingEntry createEntry(const QUrlInfo &rawEntry) const;
+	static QFtp* takeConnection(const QString &host);
+
 protected slots:
 	void processCommand(int command, bool isError);
 	void addEntry(const QUrlInfo &entry);
@@ -50,10 +60,14 @@ protected slots:
 private:
 	QFtp *m_ftp;
 	QByteArray m_content;
-	QVector<QUrlInfo> m_directories;
-	QVector<QUrlInfo> m_files;
-	QVector<QUrlInfo> m_symlinks;
+	QVector<QUrlInfo> m_heldEntries;
+	QVector<ListingEntry> m_pendingEntries;
 	qint64 m_offset;
+	int m_flushTimer;
+	bool m_isListing;
+	bool m_isReusingConnection;
+
+	static QHash<QString, QFtp*> m_connections;
 
 signals:
 	void listingError();
@@ -58,6 +58,7 @@ QtWebKitNetworkManager::QtWebKitNetworkManager(bool isPrivate, QtWebKitCookieJar
 	m_cookieJarProxy(cookieJarProxy),
 	m_proxyFactory(nullptr),
 	m_baseReply(nullptr),
+	m_blockedRequests(SettingsManager::getOption(SettingsManager::ContentBlocking_BlockedRequestsLimitOption).toInt()),
 	m_contentState(WebWidget::UnknownContentState),
 	m_doNotTrackPolicy(NetworkManagerFactory::SkipTrackPolicy),
 	m_isSecureValue(UnknownValue),
@@ -128,10 +129,10 @@ void QtWebKitNetworkManager::resetStatistics()
 
 	m_sslInformation = {};
 	m_loadingSpeedTimer = 0;
-	m_blockedElements.clear();
 	m_contentBlockingProfiles.clear();
 	m_contentBlockingExceptions.clear();
 	m_blockedRequests.clear();
+	m_blockedRequests.setLimit(SettingsManager::getOption(SettingsManager::ContentBlocking_BlockedRequestsLimitOption).toInt());
 	m_replies.clear();
 	m_headers.clear();
 	m_pageInformation = {{WebWidget::DocumentBytesReceivedInformation, quint64(0)}, {WebWidget::DocumentBytesTotalInformation, quint64(0)}, {WebWidget::TotalBytesReceivedInformation, quint64(0)}, {WebWidget::TotalBytesTotalInformation, quint64(0)}, {WebWidget::RequestsFinishedInformation, 0}, {WebWidget::RequestsStartedInformation, 0}};
@@ -671,7 +672,7 @@ QNetworkReply* QtWebKitNetworkManager::createRequest(QNetworkAccessManager::Oper
 
 				if (resourceType != NetworkManager::ScriptType && resourceType != NetworkManager::StyleSheetType)
 				{
-					m_blockedElements.append(request.url().url());
+					m_blockedRequests.addElement(request.url().url());
 				}
 
 				NetworkManager::ResourceInformation resource;
@@ -680,7 +681,7 @@ QNetworkReply* QtWebKitNetworkManager::createRequest(QNetworkAccessManager::Oper
 				resource.metaData[NetworkManager::ContentBlockingProfileMetaData] = result.profile;
 				resource.metaData[NetworkManager::ContentBlockingRuleMetaData] = result.rule;
 
-				m_blockedRequests.append(resource);
+				m_blockedRequests.addRequest(resource);
 
 				emit requestBlocked(resource);
 
@@ -820,7 +821,7 @@ QVariant QtWebKitNetworkManager::getPageInformation(WebWidget::PageInformation k
 {
 	if (key == WebWidget::RequestsBlockedInformation)
 	{
-		return m_blockedRequests.count();
+		return m_blockedRequests.getAmount();
 	}
 
 	return m_pageInformation.value(key);
@@ -833,12 +834,12 @@ WebWidget::SslInformation QtWebKitNetworkManager::getSslInformation() const
 
 QStringList QtWebKitNetworkManager::getBlockedElements() const
 {
-	return m_blockedElements;
+	return m_blockedRequests.getElements();
 }
 
-QVector<NetworkManager::ResourceInformation> QtWebKitNetworkManager::getBlockedRequests() const
+QVector<NetworkManager::ResourceInformation> QtWebKitNetworkManager::getBlockedRequests(int from, int amount) const
 {
-	return m_blockedRequests;
+	return m_blockedRequests.getRequests(from, amount);
 }
 
 QMap<QByteArray, QByteArray> QtWebKitNetworkManager::getHeaders() const
@@ -851,4 +852,9 @@ WebWidget::ContentStates QtWebKitNetworkManager::getContentState() const
 	return m_contentState;
 }
 
+int QtWebKitNetworkManager::getBlockedRequestsAmount(int profile) const
+{
+	return ((profile < 0) ? m_blockedRequests.getAmount() : m_blockedRequests.getProfileAmount(profile));
+}
+
 }
@@ -23,6 +23,7 @@
 #define OTTER_QTWEBKITNETWORKMANAGER_H
 
 #include "QtWebKitWebWidget.h"
+#include "../../../../core/BlockedRequestsLog.h"
 #include "../../../../core/NetworkManager.h"
 #include "../../../../core/NetworkManagerFactory.h"
 
@@ -46,9 +47,10 @@ public:
 	QVariant getPageInformation(WebWidget::PageInformation key) const;
 	WebWidget::SslInformation getSslInformation() const;
 	QStringList getBlockedElements() const;
-	QVector<NetworkManager::ResourceInformation> getBlockedRequests() const;
+	QVector<NetworkManager::ResourceInformation> getBlockedRequests(int from = 0, int amount = -1) const;
 	QMap<QByteArray, QByteArray> getHeaders() const;
 	WebWidget::ContentStates getContentState() const;
+	int getBlockedRequestsAmount(int profile = -1) const;
 
 protected:
 	void timerEvent(QTimerEvent *event) override;
@@ -87,10 +89,9 @@ private:
 	QUrl m_formRequestUrl;
 	QUrl m_mainRequestUrl;
 	WebWidget::SslInformation m_sslInformation;
-	QStringList m_blockedElements;
+	BlockedRequestsLog m_blockedRequests;
 	QStringList m_unblockedHosts;
 	QVector<QNetworkReply*> m_transfers;
-	QVector<NetworkManager::ResourceInformation> m_blockedRequests;
 	QVector<int> m_contentBlockingProfiles;
 	QSet<QUrl> m_contentBlockingExceptions;
 	QHash<QNetworkReply*, QPair<qint64, bool> > m_replies;
@@ -28,6 +28,9 @@ namespace Otter
 {
 
 Sonnet::Speller* QtWebKitSpellChecker::m_speller(nullptr);
+QString QtWebKitSpellChecker::m_dictionary;
+QCache<QString, bool> QtWebKitSpellChecker::m_misspelledWords(10000);
+QCache<QString, QStringList> QtWebKitSpellChecker::m_suggestions(200);
 
 QtWebKitSpellChecker::QtWebKitSpellChecker() : QWebSpellChecker()
 {
@@ -70,13 +73,10 @@ void QtWebKitSpellChecker::checkSpellingOfString(const QString &word, int *missp
 
 			const QString string(finder.string().mid(start, (end - start)));
 
-			if (isValidWord(string))
+			if (isValidWord(string) && isMisspelled(string))
 			{
-				if (m_speller->isMisspelled(string))
-				{
-					*misspellingLocation = start;
-					*misspellingLength = (end - start);
-				}
+				*misspellingLocation = start;
+				*misspellingLength = (end - start);
 
 				return;
 			}
@@ -105,6 +105,8 @@ void QtWebKitSpellChecker::learnWord(const QString &word)
 	if (m_speller)
 	{
 		m_speller->addToPersonal(word);
+
+		clearCache(word);
 	}
 }
 
@@ -113,6 +115,8 @@ void QtWebKitSpellChecker::ignoreWordInSpellDocument(const QString &word)
 	if (m_speller)
 	{
 		m_speller->addToSession(word);
+
+		clearCache(word);
 	}
 }
 
@@ -122,12 +126,35 @@ void QtWebKitSpellChecker::guessesForWord(const QString &word, const QString &co
 
 	if (m_speller)
 	{
-		guesses = m_speller->suggest(word);
+		guesses = getCachedSuggestions(word);
+	}
+}
+
+void QtWebKitSpellChecker::clearCache(const QString &word)
+{
+	if (word.isEmpty())
+	{
+		m_misspelledWords.clear();
+		m_suggestions.clear();
+	}
+	else
+	{
+		m_misspelledWords.remove(word);
+		m_suggestions.remove(word);
 	}
 }
 
 void QtWebKitSpellChecker::setDictionary(const QString &dictionary)
 {
+	if (m_speller && dictionary == m_dictionary)
+	{
+		return;
+	}
+
+	m_dictionary = dictionary;
+
+	clearCache();
+
 	if (dictionary.isEmpty() && m_speller)
 	{
 		delete m_speller;
@@ -158,15 +185,34 @@ QStringList QtWebKitSpellChecker::getSuggestions(const QString &word)
 {
 	if (!m_speller)
 	{
-		m_speller = new Sonnet::Speller(QtWebKitWebBackend::getActiveDictionary());
+		m_dictionary = QtWebKitWebBackend::getActiveDictionary();
+		m_speller = new Sonnet::Speller(m_dictionary);
+
+		clearCache();
 	}
 
-	if (m_speller->isCorrect(word))
+	if (!isMisspelled(word))
 	{
 		return {};
 	}
 
-	return m_speller->suggest(word);
+	return getCachedSuggestions(word);
+}
+
+QStringList QtWebKitSpellChecker::getCachedSuggestions(const QString &word)
+{
+	const QStringList *cachedSuggestions(m_suggestions.object(word));
+
+	if (cachedSuggestions)
+	{
+		return *cachedSuggestions;
+	}
+
+	const QStringList suggestions(m_speller->suggest(word));
+
+	m_suggestions.insert(word, new QStringList(suggestions));
+
+	return suggestions;
 }
 
 bool QtWebKitSpellChecker::isContinousSpellCheckingEnabled() const
@@ -179,6 +225,22 @@ bool QtWebKitSpellChecker::isGrammarCheckingEnabled()
 	return false;
 }
 
+bool QtWebKitSpellChecker::isMisspelled(const QString &word)
+{
+	const bool *isCachedMisspelled(m_misspelledWords.object(word));
+
+	if (isCachedMisspelled)
+	{
+		return *isCachedMisspelled;
+	}
+
+	const bool isWordMisspelled(m_speller->isMisspelled(word));
+
+	m_misspelledWords.insert(word, new bool(isWordMisspelled));
+
+	return isWordMisspelled;
+}
+
 bool QtWebKitSpellChecker::isValidWord(const QString &string)
 {
 	if (string.isEmpty() || (string.length() == 1 && !string.at(0).isLetter()))
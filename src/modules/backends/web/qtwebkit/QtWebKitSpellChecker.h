@@ -25,6 +25,8 @@
 #include "qwebkitplatformplugin.h"
 #include "../../../../../3rdparty/sonnet/src/core/speller.h"
 
+#include <QtCore/QCache>
+
 namespace Otter
 {
 
@@ -48,6 +50,9 @@ public:
 	bool isGrammarCheckingEnabled() override;
 
 protected:
+	static void clearCache(const QString &word = {});
+	static QStringList getCachedSuggestions(const QString &word);
+	static bool isMisspelled(const QString &word);
 	static bool isValidWord(const QString &string);
 
 protected slots:
@@ -55,6 +60,9 @@ protected slots:
 
 private:
 	static Sonnet::Speller *m_speller;
+	static QString m_dictionary;
+	static QCache<QString, bool> m_misspelledWords;
+	static QCache<QString, QStringList> m_suggestions;
 };
 
 }
@@ -134,6 +134,10 @@ QtWebKitWebWidget::QtWebKitWebWidget(const QVariantMap &parameters, WebBackend *
 	connect(m_page, &QtWebKitPage::downloadRequested, this, &QtWebKitWebWidget::handleDownloadRequested);
 	connect(m_page, &QtWebKitPage::unsupportedContent, this, &QtWebKitWebWidget::handleUnsupportedContent);
 	connect(m_page, &QtWebKitPage::linkHovered, this, &QtWebKitWebWidget::setStatusMessageOverride);
+	connect(m_page, &QtWebKitPage::scrollRequested, this, [&]()
+	{
+		SessionsManager::markSessionAsModified(getWindowIdentifier());
+	});
 	connect(m_page, &QtWebKitPage::microFocusChanged, [&]()
 	{
 		emit categorizedActionsStateChanged({ActionsManager::ActionDefinition::EditingCategory});
@@ -244,9 +248,34 @@ void QtWebKitWebWidget::search(const QString &query, const QString &searchEngine
 	}
 }
 
-void QtWebKitWebWidget::print(QPrinter *printer)
+void QtWebKitWebWidget::print(QPrinter *printer, const std::function<void(bool)> &callback)
 {
 	m_page->mainFrame()->print(printer);
+
+	callback(true);
+}
+
+void QtWebKitWebWidget::findInPage(const QString &text, FindFlags flags)
+{
+	QWebPage::FindFlags nativeFlags(QWebPage::FindWrapsAroundDocument | QWebPage::FindBeginsInSelection);
+
+	if (flags.testFlag(BackwardFind))
+	{
+		nativeFlags |= QWebPage::FindBackward;
+	}
+
+	if (flags.testFlag(CaseSensitiveFind))
+	{
+		nativeFlags |= QWebPage::FindCaseSensitively;
+	}
+
+	if (flags.testFlag(HighlightAllFind) || text.isEmpty())
+	{
+		m_page->findText({}, QWebPage::HighlightAllOccurrences);
+		m_page->findText(text, (nativeFlags | QWebPage::HighlightAllOccurrences));
+	}
+
+	emit findInPageResultsChanged(text, (m_page->findText(text, nativeFlags) ? -1 : 0));
 }
 
 void QtWebKitWebWidget::saveState(QWebFrame *frame, QWebHistoryItem *item)
@@ -266,6 +295,8 @@ void QtWebKitWebWidget::saveState(QWebFrame *frame, QWebHistoryItem *item)
 		}
 
 		item->setUserData(state);
+
+		SessionsManager::markSessionAsModified(getWindowIdentifier());
 	}
 }
 
@@ -620,7 +651,7 @@ void QtWebKitWebWidget::handleHistory()
 			m_isTypedIn = false;
 		}
 
-		SessionsManager::markSessionAsModified();
+		SessionsManager::markSessionAsModified(getWindowIdentifier());
 		BookmarksManager::updateVisits(url.toString());
 	}
 }
@@ -708,7 +739,7 @@ void QtWebKitWebWidget::notifyUrlChanged(const QUrl &url)
 	emit arbitraryActionsStateChanged({ActionsManager::InspectPageAction, ActionsManager::InspectElementAction});
 	emit categorizedActionsStateChanged({ActionsManager::ActionDefinition::NavigationCategory, ActionsManager::ActionDefinition::PageCategory});
 
-	SessionsManager::markSessionAsModified();
+	SessionsManager::markSessionAsModified(getWindowIdentifier());
 }
 
 void QtWebKitWebWidget::notifyIconChanged()
@@ -1815,7 +1846,7 @@ void QtWebKitWebWidget::setZoom(int zoom)
 	{
 		m_page->mainFrame()->setZoomFactor(qBound(0.1, (static_cast<qreal>(zoom) / 100), static_cast<qreal>(100)));
 
-		SessionsManager::markSessionAsModified();
+		SessionsManager::markSessionAsModified(getWindowIdentifier());
 
 		emit zoomChanged(zoom);
 		emit geometryChanged();
@@ -2485,9 +2516,9 @@ QVector<WebWidget::LinkUrl> QtWebKitWebWidget::getSearchEngines() const
 	return getLinks(QLatin1String("link[type='application/opensearchdescription+xml']"));
 }
 
-QVector<NetworkManager::ResourceInformation> QtWebKitWebWidget::getBlockedRequests() const
+QVector<NetworkManager::ResourceInformation> QtWebKitWebWidget::getBlockedRequests(int from, int amount) const
 {
-	return m_networkManager->getBlockedRequests();
+	return m_networkManager->getBlockedRequests(from, amount);
 }
 
 QMap<QByteArray, QByteArray> QtWebKitWebWidget::getHeaders() const
@@ -2529,6 +2560,11 @@ WebWidget::LoadingState QtWebKitWebWidget::getLoadingState() const
 	return m_loadingState;
 }
 
+int QtWebKitWebWidget::getBlockedRequestsAmount(int profile) const
+{
+	return m_networkManager->getBlockedRequestsAmount(profile);
+}
+
 int QtWebKitWebWidget::getZoom() const
 {
 	return static_cast<int>(m_page->mainFrame()->zoomFactor() * 100);
@@ -2539,29 +2575,6 @@ int QtWebKitWebWidget::getAmountOfDeferredPlugins() const
 	return m_amountOfDeferredPlugins;
 }
 
-int QtWebKitWebWidget::findInPage(const QString &text, FindFlags flags)
-{
-	QWebPage::FindFlags nativeFlags(QWebPage::FindWrapsAroundDocument | QWebPage::FindBeginsInSelection);
-
-	if (flags.testFlag(BackwardFind))
-	{
-		nativeFlags |= QWebPage::FindBackward;
-	}
-
-	if (flags.testFlag(CaseSensitiveFind))
-	{
-		nativeFlags |= QWebPage::FindCaseSensitively;
-	}
-
-	if (flags.testFlag(HighlightAllFind) || text.isEmpty())
-	{
-		m_page->findText({}, QWebPage::HighlightAllOccurrences);
-		m_page->findText(text, (nativeFlags | QWebPage::HighlightAllOccurrences));
-	}
-
-	return (m_page->findText(text, nativeFlags) ? -1 : 0);
-}
-
 bool QtWebKitWebWidget::canLoadPlugins() const
 {
 	return m_canLoadPlugins;
@@ -46,7 +46,8 @@ public:
 	~QtWebKitWebWidget();
 
 	void search(const QString &query, const QString &searchEngine) override;
-	void print(QPrinter *printer) override;
+	void print(QPrinter *printer, const std::function<void(bool)> &callback) override;
+	void findInPage(const QString &text, FindFlags flags = NoFlagsFind) override;
 	WebWidget* clone(bool cloneHistory = true, bool isPrivate = false, const QStringList &excludedOptions = {}) const override;
 	QWidget* getInspector() override;
 	QWidget* getViewport() override;
@@ -72,13 +73,13 @@ public:
 	QVector<LinkUrl> getFeeds() const override;
 	QVector<LinkUrl> getLinks() const override;
 	QVector<LinkUrl> getSearchEngines() const override;
-	QVector<NetworkManager::ResourceInformation> getBlockedRequests() const override;
+	QVector<NetworkManager::ResourceInformation> getBlockedRequests(int from = 0, int amount = -1) const override;
 	QMap<QByteArray, QByteArray> getHeaders() const override;
 	QMultiMap<QString, QString> getMetaData() const override;
 	ContentStates getContentState() const override;
 	LoadingState getLoadingState() const override;
+	int getBlockedRequestsAmount(int profile = -1) const override;
 	int getZoom() const override;
-	int findInPage(const QString &text, FindFlags flags = NoFlagsFind) override;
 	bool hasSelection() const override;
 	bool hasWatchedChanges(ChangeWatcher watcher) const override;
 	bool isAudible() const override;
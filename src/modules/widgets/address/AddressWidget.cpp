@@ -312,6 +312,7 @@ QSize AddressDelegate::sizeHint(const QStyleOptionViewItem &option, const QModel
 AddressWidget::AddressWidget(Window *window, QWidget *parent) : LineEditWidget(parent),
 	m_window(nullptr),
 	m_completionModel(new AddressCompletionModel(this)),
+	m_inputInterpreter(nullptr),
 	m_clickedEntry(UnknownEntry),
 	m_hoveredEntry(UnknownEntry),
 	m_completionModes(NoCompletionMode),
@@ -352,6 +353,11 @@ AddressWidget::AddressWidget(Window *window, QWidget *parent) : LineEditWidget(p
 	connect(this, &AddressWidget::textEdited, this, [&]()
 	{
 		m_wasEdited = true;
+
+		if (m_inputInterpreter)
+		{
+			m_inputInterpreter->cancel();
+		}
 	});
 	connect(this, &AddressWidget::textDropped, this, [&](const QString &text)
 	{
@@ -945,40 +951,58 @@ void AddressWidget::handleUserInput(const QString &text, SessionsManager::OpenHi
 		hints = SessionsManager::calculateOpenHints(SessionsManager::CurrentTabOpen);
 	}
 
-	if (!text.isEmpty())
+	if (text.isEmpty())
+	{
+		return;
+	}
+
+	if (m_inputInterpreter)
 	{
-		const InputInterpreter::InterpreterResult result(InputInterpreter::interpret(text));
+		m_inputInterpreter->cancel();
+		m_inputInterpreter->deleteLater();
+	}
 
-		if (result.isValid())
+	m_inputInterpreter = new InputInterpreter(this);
+
+	connect(m_inputInterpreter, &InputInterpreter::finished, this, [=](const InputInterpreter::InterpreterResult &result)
+	{
+		m_inputInterpreter->deleteLater();
+		m_inputInterpreter = nullptr;
+
+		if (!result.isValid())
 		{
-			MainWindow *mainWindow(m_window ? MainWindow::findMainWindow(m_window) : MainWindow::findMainWindow(this));
-			ActionExecutor::Object executor(mainWindow, mainWindow);
+			return;
+		}
 
-			switch (result.type)
-			{
-				case InputInterpreter::InterpreterResult::BookmarkType:
-					if (executor.isValid())
-					{
-						executor.triggerAction(ActionsManager::OpenBookmarkAction, {{QLatin1String("bookmark"), result.bookmark->getIdentifier()}, {QLatin1String("hints"), QVariant(hints)}});
-					}
+		MainWindow *mainWindow(m_window ? MainWindow::findMainWindow(m_window) : MainWindow::findMainWindow(this));
+		ActionExecutor::Object executor(mainWindow, mainWindow);
 
-					break;
-				case InputInterpreter::InterpreterResult::UrlType:
-					if (executor.isValid())
-					{
-						executor.triggerAction(ActionsManager::OpenUrlAction, {{QLatin1String("url"), result.url}, {QLatin1String("hints"), QVariant(hints)}});
-					}
+		switch (result.type)
+		{
+			case InputInterpreter::InterpreterResult::BookmarkType:
+				if (executor.isValid())
+				{
+					executor.triggerAction(ActionsManager::OpenBookmarkAction, {{QLatin1String("bookmark"), result.bookmark->getIdentifier()}, {QLatin1String("hints"), QVariant(hints)}});
+				}
 
-					break;
-				case InputInterpreter::InterpreterResult::SearchType:
-					emit requestedSearch(result.searchQuery, result.searchEngine, hints);
+				break;
+			case InputInterpreter::InterpreterResult::UrlType:
+				if (executor.isValid())
+				{
+					executor.triggerAction(ActionsManager::OpenUrlAction, {{QLatin1String("url"), result.url}, {QLatin1String("hints"), QVariant(hints)}});
+				}
 
-					break;
-				default:
-					break;
-			}
+				break;
+			case InputInterpreter::InterpreterResult::SearchType:
+				emit requestedSearch(result.searchQuery, result.searchEngine, hints);
+
+				break;
+			default:
+				break;
 		}
-	}
+	});
+
+	m_inputInterpreter->start(text);
 }
 
 void AddressWidget::updateGeometries()
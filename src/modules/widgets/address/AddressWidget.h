@@ -34,6 +34,7 @@ namespace Otter
 {
 
 class AddressCompletionModel;
+class InputInterpreter;
 class ItemViewWidget;
 class Window;
 
@@ -148,6 +149,7 @@ protected slots:
 private:
 	QPointer<Window> m_window;
 	AddressCompletionModel *m_completionModel;
+	InputInterpreter *m_inputInterpreter;
 	QPoint m_dragStartPosition;
 	QVector<EntryIdentifier> m_layout;
 	QHash<EntryIdentifier, EntryDefinition> m_entries;
@@ -138,7 +138,7 @@ void ContentBlockingInformationWidget::populateElementsMenu()
 		return;
 	}
 
-	const QVector<NetworkManager::ResourceInformation> requests(m_window->getWebWidget()->getBlockedRequests().mid(m_amount - 50));
+	const QVector<NetworkManager::ResourceInformation> requests(m_window->getWebWidget()->getBlockedRequests(m_amount - 50));
 
 	for (int i = 0; i < requests.count(); ++i)
 	{
@@ -212,23 +212,6 @@ void ContentBlockingInformationWidget::populateProfilesMenu()
 
 	m_profilesMenu->addSeparator();
 
-	const QVector<NetworkManager::ResourceInformation> requests(m_window->getWebWidget()->getBlockedRequests());
-	QHash<QString, int> amounts;
-
-	for (int i = 0; i < requests.count(); ++i)
-	{
-		const QString profile(requests.at(i).metaData.value(NetworkManager::ContentBlockingProfileMetaData).toString());
-
-		if (amounts.contains(profile))
-		{
-			++amounts[profile];
-		}
-		else
-		{
-			amounts[profile] = 1;
-		}
-	}
-
 	const QVector<ContentFiltersProfile*> profiles(ContentFiltersManager::getContentBlockingProfiles());
 	const QStringList enabledProfiles(m_window->getOption(SettingsManager::ContentBlocking_ProfilesOption).toStringList());
 
@@ -236,7 +219,7 @@ void ContentBlockingInformationWidget::populateProfilesMenu()
 	{
 		if (profiles.at(i))
 		{
-			const int amount(amounts.value(profiles.at(i)->getName()));
+			const int amount(m_window->getWebWidget()->getBlockedRequestsAmount(i));
 			const QString title(Utils::elideText(profiles.at(i)->getTitle(), m_profilesMenu->fontMetrics(), m_profilesMenu));
 			QAction *profileAction(m_profilesMenu->addAction((amount > 0) ? QStringLiteral("%1 (%2)").arg(title).arg(amount) : title));
 			profileAction->setData(profiles.at(i)->getName());
@@ -335,7 +318,7 @@ void ContentBlockingInformationWidget::setWindow(Window *window)
 
 	if (window && window->getWebWidget())
 	{
-		m_amount = window->getWebWidget()->getBlockedRequests().count();
+		m_amount = window->getWebWidget()->getBlockedRequestsAmount();
 		m_isContentBlockingEnabled = (m_window->getOption(SettingsManager::ContentBlocking_EnableContentBlockingOption).toBool());
 
 		connect(m_window, &Window::aboutToNavigate, this, &ContentBlockingInformationWidget::clear);
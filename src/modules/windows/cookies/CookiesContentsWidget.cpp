@@ -39,6 +39,7 @@ namespace Otter
 
 CookiesContentsWidget::CookiesContentsWidget(const QVariantMap &parameters, Window *window, QWidget *parent) : ContentsWidget(parameters, window, parent),
 	m_model(new QStandardItemModel(this)),
+	m_updateTimer(0),
 	m_isLoading(true),
 	m_ui(new Ui::CookiesContentsWidget)
 {
@@ -65,6 +66,53 @@ CookiesContentsWidget::~CookiesContentsWidget()
 	delete m_ui;
 }
 
+void CookiesContentsWidget::timerEvent(QTimerEvent *event)
+{
+	if (event->timerId() == m_updateTimer)
+	{
+		killTimer(m_updateTimer);
+
+		m_updateTimer = 0;
+
+		const QVector<CookieChange> changes(m_cookieChanges);
+		QPoint point;
+		bool needsSorting(false);
+
+		m_cookieChanges.clear();
+
+		for (int i = 0; i < changes.count(); ++i)
+		{
+			if (changes.at(i).isRemoved)
+			{
+				removeCookie(changes.at(i).cookie, &point);
+			}
+			else if (insertCookie(changes.at(i).cookie))
+			{
+				needsSorting = true;
+			}
+		}
+
+		if (needsSorting)
+		{
+			m_model->sort(0);
+		}
+
+		if (!point.isNull())
+		{
+			const QModelIndex index(m_ui->cookiesViewWidget->indexAt(point));
+
+			m_ui->cookiesViewWidget->setCurrentIndex(index);
+			m_ui->cookiesViewWidget->selectionModel()->select(index, QItemSelectionModel::Select);
+		}
+
+		updateActions();
+	}
+	else
+	{
+		ContentsWidget::timerEvent(event);
+	}
+}
+
 void CookiesContentsWidget::changeEvent(QEvent *event)
 {
 	ContentsWidget::changeEvent(event);
@@ -79,12 +127,29 @@ void CookiesContentsWidget::populateCookies()
 {
 	const CookieJar *cookieJar(NetworkManagerFactory::getCookieJar());
 	const QVector<QNetworkCookie> cookies(cookieJar->getCookies());
+	QList<QStandardItem*> domainItems;
 
 	for (int i = 0; i < cookies.count(); ++i)
 	{
-		handleCookieAdded(cookies.at(i));
+		const QString domain(getCookieDomain(cookies.at(i)));
+		QStandardItem *domainItem(m_domainItems.value(domain, nullptr));
+
+		if (!domainItem)
+		{
+			domainItem = createDomainItem(domain);
+
+			domainItems.append(domainItem);
+		}
+
+		domainItem->appendRow(createCookieItem(cookies.at(i)));
 	}
 
+	for (int i = 0; i < domainItems.count(); ++i)
+	{
+		domainItems.at(i)->setText(QStringLiteral("%1 (%2)").arg(domainItems.at(i)->toolTip()).arg(domainItems.at(i)->rowCount()));
+	}
+
+	m_model->invisibleRootItem()->appendRows(domainItems);
 	m_model->sort(0);
 
 	m_ui->cookiesViewWidget->setViewMode(ItemViewWidget::TreeView);
@@ -245,90 +310,64 @@ void CookiesContentsWidget::cookieProperties()
 
 void CookiesContentsWidget::handleCookieAdded(const QNetworkCookie &cookie)
 {
-	const QString domain(cookie.domain().startsWith(QLatin1Char('.')) ? cookie.domain().mid(1) : cookie.domain());
-	QStandardItem *domainItem(findDomainItem(domain));
+	CookieChange change;
+	change.cookie = cookie;
 
-	if (domainItem)
+	m_cookieChanges.append(change);
+
+	if (m_updateTimer == 0)
 	{
-		for (int i = 0; i < domainItem->rowCount(); ++i)
-		{
-			QStandardItem *childItem(domainItem->child(i, 0));
+		m_updateTimer = startTimer(50);
+	}
+}
 
-			if (childItem && cookie.hasSameIdentifier(getCookie(childItem->index().data(Qt::UserRole))))
-			{
-				childItem->setData(cookie.toRawForm());
+void CookiesContentsWidget::handleCookieRemoved(const QNetworkCookie &cookie)
+{
+	CookieChange change;
+	change.cookie = cookie;
+	change.isRemoved = true;
 
-				updateActions();
+	m_cookieChanges.append(change);
 
-				return;
-			}
-		}
-	}
-	else
+	if (m_updateTimer == 0)
 	{
-		domainItem = new QStandardItem(HistoryManager::getIcon(QUrl(QStringLiteral("http://%1/").arg(domain))), domain);
-		domainItem->setToolTip(domain);
-
-		m_model->appendRow(domainItem);
-
-		if (sender())
-		{
-			m_model->sort(0);
-		}
+		m_updateTimer = startTimer(50);
 	}
-
-	QStandardItem *cookieItem(new QStandardItem(QString(cookie.name())));
-	cookieItem->setData(cookie.toRawForm(), Qt::UserRole);
-	cookieItem->setToolTip(cookie.name());
-	cookieItem->setFlags(cookieItem->flags() | Qt::ItemNeverHasChildren);
-
-	domainItem->appendRow(cookieItem);
-	domainItem->setText(QStringLiteral("%1 (%2)").arg(domain).arg(domainItem->rowCount()));
 }
 
-void CookiesContentsWidget::handleCookieRemoved(const QNetworkCookie &cookie)
+void CookiesContentsWidget::removeCookie(const QNetworkCookie &cookie, QPoint *point)
 {
-	const QString domain(cookie.domain().startsWith(QLatin1Char('.')) ? cookie.domain().mid(1) : cookie.domain());
+	const QString domain(getCookieDomain(cookie));
 	QStandardItem *domainItem(findDomainItem(domain));
 
-	if (domainItem)
+	if (!domainItem)
 	{
-		QPoint point;
-
-		for (int j = 0; j < domainItem->rowCount(); ++j)
-		{
-			if (cookie.hasSameIdentifier(getCookie(ItemModel::getItemData(domainItem->child(j, 0), Qt::UserRole))))
-			{
-				const QStandardItem *cookieItem(domainItem->child(j, 0));
-
-				if (cookieItem)
-				{
-					point = m_ui->cookiesViewWidget->visualRect(cookieItem->index()).center();
-				}
-
-				domainItem->removeRow(j);
+		return;
+	}
 
-				break;
-			}
-		}
+	for (int i = 0; i < domainItem->rowCount(); ++i)
+	{
+		const QStandardItem *cookieItem(domainItem->child(i, 0));
 
-		if (domainItem->rowCount() == 0)
-		{
-			m_model->invisibleRootItem()->removeRow(domainItem->row());
-		}
-		else
+		if (cookieItem && cookie.hasSameIdentifier(getCookie(cookieItem->data(Qt::UserRole))))
 		{
-			domainItem->setText(QStringLiteral("%1 (%2)").arg(domain).arg(domainItem->rowCount()));
-		}
+			*point = m_ui->cookiesViewWidget->visualRect(cookieItem->index()).center();
 
-		if (!point.isNull())
-		{
-			const QModelIndex index(m_ui->cookiesViewWidget->indexAt(point));
+			domainItem->removeRow(i);
 
-			m_ui->cookiesViewWidget->setCurrentIndex(index);
-			m_ui->cookiesViewWidget->selectionModel()->select(index, QItemSelectionModel::Select);
+			break;
 		}
 	}
+
+	if (domainItem->rowCount() == 0)
+	{
+		m_domainItems.remove(domain);
+		m_model->invisibleRootItem()->removeRow(domainItem->row());
+	}
+	else
+	{
+		domainItem->setText(QStringLiteral("%1 (%2)").arg(domain).arg(domainItem->rowCount()));
+	}
 }
 
 void CookiesContentsWidget::showContextMenu(const QPoint &position)
@@ -425,19 +464,29 @@ void CookiesContentsWidget::updateActions()
 	emit categorizedActionsStateChanged({ActionsManager::ActionDefinition::EditingCategory});
 }
 
-QStandardItem* CookiesContentsWidget::findDomainItem(const QString &domain)
+QStandardItem* CookiesContentsWidget::createDomainItem(const QString &domain)
 {
-	for (int i = 0; i < m_model->rowCount(); ++i)
-	{
-		QStandardItem *item(m_model->item(i, 0));
+	QStandardItem *domainItem(new QStandardItem(HistoryManager::getIcon(QUrl(QStringLiteral("http://%1/").arg(domain))), domain));
+	domainItem->setToolTip(domain);
 
-		if (item && domain == item->toolTip())
-		{
-			return item;
-		}
-	}
+	m_domainItems[domain] = domainItem;
 
-	return nullptr;
+	return domainItem;
+}
+
+QStandardItem* CookiesContentsWidget::createCookieItem(const QNetworkCookie &cookie) const
+{
+	QStandardItem *cookieItem(new QStandardItem(QString(cookie.name())));
+	cookieItem->setData(cookie.toRawForm(), Qt::UserRole);
+	cookieItem->setToolTip(cookie.name());
+	cookieItem->setFlags(cookieItem->flags() | Qt::ItemNeverHasChildren);
+
+	return cookieItem;
+}
+
+QStandardItem* CookiesContentsWidget::findDomainItem(const QString &domain)
+{
+	return m_domainItems.value(domain, nullptr);
 }
 
 QString CookiesContentsWidget::getTitle() const
@@ -460,6 +509,11 @@ QIcon CookiesContentsWidget::getIcon() const
 	return ThemesManager::createIcon(QLatin1String("cookies"), false);
 }
 
+QString CookiesContentsWidget::getCookieDomain(const QNetworkCookie &cookie) const
+{
+	return (cookie.domain().startsWith(QLatin1Char('.')) ? cookie.domain().mid(1) : cookie.domain());
+}
+
 QNetworkCookie CookiesContentsWidget::getCookie(const QVariant &data) const
 {
 	const QList<QNetworkCookie> cookies(QNetworkCookie::parseCookies(data.toByteArray()));
@@ -494,6 +548,41 @@ WebWidget::LoadingState CookiesContentsWidget::getLoadingState() const
 	return (m_isLoading ? WebWidget::OngoingLoadingState : WebWidget::FinishedLoadingState);
 }
 
+bool CookiesContentsWidget::insertCookie(const QNetworkCookie &cookie)
+{
+	const QString domain(getCookieDomain(cookie));
+	QStandardItem *domainItem(findDomainItem(domain));
+	bool hasNewDomain(false);
+
+	if (domainItem)
+	{
+		for (int i = 0; i < domainItem->rowCount(); ++i)
+		{
+			QStandardItem *cookieItem(domainItem->child(i, 0));
+
+			if (cookieItem && cookie.hasSameIdentifier(getCookie(cookieItem->data(Qt::UserRole))))
+			{
+				cookieItem->setData(cookie.toRawForm(), Qt::UserRole);
+
+				return false;
+			}
+		}
+	}
+	else
+	{
+		domainItem = createDomainItem(domain);
+
+		m_model->appendRow(domainItem);
+
+		hasNewDomain = true;
+	}
+
+	domainItem->appendRow(createCookieItem(cookie));
+	domainItem->setText(QStringLiteral("%1 (%2)").arg(domain).arg(domainItem->rowCount()));
+
+	return hasNewDomain;
+}
+
 bool CookiesContentsWidget::eventFilter(QObject *object, QEvent *event)
 {
 	if (object == m_ui->cookiesViewWidget && event->type() == QEvent::KeyPress && static_cast<QKeyEvent*>(event)->key() == Qt::Key_Delete)
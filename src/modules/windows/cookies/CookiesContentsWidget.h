@@ -56,9 +56,21 @@ public slots:
 	void triggerAction(int identifier, const QVariantMap &parameters = {}, ActionsManager::TriggerType trigger = ActionsManager::UnknownTrigger) override;
 
 protected:
+	struct CookieChange final
+	{
+		QNetworkCookie cookie;
+		bool isRemoved = false;
+	};
+
+	void timerEvent(QTimerEvent *event) override;
 	void changeEvent(QEvent *event) override;
+	void removeCookie(const QNetworkCookie &cookie, QPoint *point);
+	QStandardItem* createDomainItem(const QString &domain);
+	QStandardItem* createCookieItem(const QNetworkCookie &cookie) const;
 	QStandardItem* findDomainItem(const QString &domain);
+	QString getCookieDomain(const QNetworkCookie &cookie) const;
 	QNetworkCookie getCookie(const QVariant &data) const;
+	bool insertCookie(const QNetworkCookie &cookie);
 
 protected slots:
 	void populateCookies();
@@ -74,6 +86,9 @@ protected slots:
 
 private:
 	QStandardItemModel *m_model;
+	QHash<QString, QStandardItem*> m_domainItems;
+	QVector<CookieChange> m_cookieChanges;
+	int m_updateTimer;
 	bool m_isLoading;
 	Ui::CookiesContentsWidget *m_ui;
 };
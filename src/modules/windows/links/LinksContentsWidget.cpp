@@ -37,6 +37,7 @@ namespace Otter
 
 LinksContentsWidget::LinksContentsWidget(const QVariantMap &parameters, QWidget *parent) : ContentsWidget(parameters, nullptr, parent),
 	m_window(nullptr),
+	m_updateTimer(0),
 	m_isLocked(false),
 	m_ui(new Ui::LinksContentsWidget)
 {
@@ -62,7 +63,7 @@ LinksContentsWidget::LinksContentsWidget(const QVariantMap &parameters, QWidget
 			{
 				if (m_window)
 				{
-					disconnect(m_window, &Window::loadingStateChanged, this, &LinksContentsWidget::updateLinks);
+					disconnect(m_window, &Window::loadingStateChanged, this, &LinksContentsWidget::scheduleLinksUpdate);
 
 					if (m_window->getWebWidget())
 					{
@@ -76,7 +77,7 @@ LinksContentsWidget::LinksContentsWidget(const QVariantMap &parameters, QWidget
 
 				if (window)
 				{
-					connect(window, &Window::loadingStateChanged, this, &LinksContentsWidget::updateLinks);
+					connect(window, &Window::loadingStateChanged, this, &LinksContentsWidget::scheduleLinksUpdate);
 
 					if (window->getWebWidget())
 					{
@@ -115,6 +116,22 @@ LinksContentsWidget::~LinksContentsWidget()
 	delete m_ui;
 }
 
+void LinksContentsWidget::timerEvent(QTimerEvent *event)
+{
+	if (event->timerId() == m_updateTimer)
+	{
+		killTimer(m_updateTimer);
+
+		m_updateTimer = 0;
+
+		updateLinks();
+	}
+	else
+	{
+		ContentsWidget::timerEvent(event);
+	}
+}
+
 void LinksContentsWidget::changeEvent(QEvent *event)
 {
 	ContentsWidget::changeEvent(event);
@@ -174,14 +191,6 @@ void LinksContentsWidget::triggerAction(int identifier, const QVariantMap &param
 	}
 }
 
-void LinksContentsWidget::addLink(const QString &title, const QUrl &url)
-{
-	QStandardItem *item(new QStandardItem(title.isEmpty() ? url.toDisplayString(QUrl::RemovePassword) : title));
-	item->setData(url, Qt::StatusTipRole);
-
-	m_ui->linksViewWidget->getSourceModel()->appendRow(item);
-}
-
 void LinksContentsWidget::openLink()
 {
 	const QAction *action(qobject_cast<QAction*>(sender()));
@@ -201,7 +210,15 @@ void LinksContentsWidget::handleWatchedDataChanged(WebWidget::ChangeWatcher watc
 {
 	if (watcher == WebWidget::LinksWatcher)
 	{
-		updateLinks();
+		scheduleLinksUpdate();
+	}
+}
+
+void LinksContentsWidget::scheduleLinksUpdate()
+{
+	if (!m_isLocked && m_updateTimer == 0)
+	{
+		m_updateTimer = startTimer(500);
 	}
 }
 
@@ -212,25 +229,80 @@ void LinksContentsWidget::updateLinks()
 		return;
 	}
 
-	m_ui->linksViewWidget->getSourceModel()->clear();
+	if (m_updateTimer != 0)
+	{
+		killTimer(m_updateTimer);
 
-	if (m_window && m_window->getWebWidget())
+		m_updateTimer = 0;
+	}
+
+	QStandardItemModel *model(m_ui->linksViewWidget->getSourceModel());
+
+	if (!m_window || !m_window->getWebWidget())
 	{
-		const QVector<WebWidget::LinkUrl> links(m_window->getWebWidget()->getLinks());
+		model->clear();
 
-		addLink(m_window->getTitle(), m_window->getUrl());
+		return;
+	}
 
-		if (!links.isEmpty())
-		{
-			m_ui->linksViewWidget->getSourceModel()->appendRow(new ItemModel::Item(ItemModel::SeparatorType));
+	const QVector<WebWidget::LinkUrl> links(m_window->getWebWidget()->getLinks());
+	QStandardItem *pageItem(model->item(0));
 
-			for (int i = 0; i < links.count(); ++i)
-			{
-				addLink(links.at(i).title, links.at(i).url);
-			}
+	if (!pageItem)
+	{
+		model->appendRow(createLinkItem(m_window->getTitle(), m_window->getUrl()));
+	}
+	else if (!isSameLink(pageItem, m_window->getTitle(), m_window->getUrl()))
+	{
+		pageItem->setText(getLinkText(m_window->getTitle(), m_window->getUrl()));
+		pageItem->setData(m_window->getUrl(), Qt::StatusTipRole);
+	}
+
+	if (links.isEmpty())
+	{
+		if (model->rowCount() > 1)
+		{
+			model->removeRows(1, (model->rowCount() - 1));
 		}
 
-		m_ui->linksViewWidget->expandAll();
+		return;
+	}
+
+	if (model->rowCount() < 2)
+	{
+		model->appendRow(new ItemModel::Item(ItemModel::SeparatorType));
+	}
+
+	const int offset(2);
+	const int amount(model->rowCount() - offset);
+	int prefix(0);
+	int suffix(0);
+
+	while (prefix < amount && prefix < links.count() && isSameLink(model->item(offset + prefix), links.at(prefix).title, links.at(prefix).url))
+	{
+		++prefix;
+	}
+
+	while (suffix < (amount - prefix) && suffix < (links.count() - prefix) && isSameLink(model->item(offset + amount - suffix - 1), links.at(links.count() - suffix - 1).title, links.at(links.count() - suffix - 1).url))
+	{
+		++suffix;
+	}
+
+	if ((amount - prefix - suffix) > 0)
+	{
+		model->removeRows((offset + prefix), (amount - prefix - suffix));
+	}
+
+	QList<QStandardItem*> items;
+
+	for (int i = prefix; i < (links.count() - suffix); ++i)
+	{
+		items.append(createLinkItem(links.at(i).title, links.at(i).url));
+	}
+
+	if (!items.isEmpty())
+	{
+		model->invisibleRootItem()->insertRows((offset + prefix), items);
 	}
 }
 
@@ -268,11 +340,25 @@ void LinksContentsWidget::showContextMenu(const QPoint &position)
 	menu.exec(m_ui->linksViewWidget->mapToGlobal(position));
 }
 
+QStandardItem* LinksContentsWidget::createLinkItem(const QString &title, const QUrl &url) const
+{
+	QStandardItem *item(new QStandardItem(getLinkText(title, url)));
+	item->setData(url, Qt::StatusTipRole);
+	item->setFlags(item->flags() | Qt::ItemNeverHasChildren);
+
+	return item;
+}
+
 QString LinksContentsWidget::getTitle() const
 {
 	return tr("Links");
 }
 
+QString LinksContentsWidget::getLinkText(const QString &title, const QUrl &url) const
+{
+	return (title.isEmpty() ? url.toDisplayString(QUrl::RemovePassword) : title);
+}
+
 QLatin1String LinksContentsWidget::getType() const
 {
 	return QLatin1String("links");
@@ -310,6 +396,11 @@ ActionsManager::ActionDefinition::State LinksContentsWidget::getActionState(int
 	return ContentsWidget::getActionState(identifier, parameters);
 }
 
+bool LinksContentsWidget::isSameLink(const QStandardItem *item, const QString &title, const QUrl &url) const
+{
+	return (item && item->data(Qt::StatusTipRole).toUrl() == url && item->text() == getLinkText(title, url));
+}
+
 bool LinksContentsWidget::eventFilter(QObject *object, QEvent *event)
 {
 	if (object == m_ui->linksViewWidget->viewport() && event->type() == QEvent::ToolTip)
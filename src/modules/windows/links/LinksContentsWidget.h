@@ -53,17 +53,22 @@ public slots:
 	void triggerAction(int identifier, const QVariantMap &parameters = {}, ActionsManager::TriggerType trigger = ActionsManager::UnknownTrigger) override;
 
 protected:
+	void timerEvent(QTimerEvent *event) override;
 	void changeEvent(QEvent *event) override;
-	void addLink(const QString &title, const QUrl &url);
 	void updateLinks();
+	QStandardItem* createLinkItem(const QString &title, const QUrl &url) const;
+	QString getLinkText(const QString &title, const QUrl &url) const;
+	bool isSameLink(const QStandardItem *item, const QString &title, const QUrl &url) const;
 
 protected slots:
 	void openLink();
 	void handleWatchedDataChanged(WebWidget::ChangeWatcher watcher);
+	void scheduleLinksUpdate();
 	void showContextMenu(const QPoint &position);
 
 private:
 	Window *m_window;
+	int m_updateTimer;
 	bool m_isLocked;
 	Ui::LinksContentsWidget *m_ui;
 };
@@ -436,10 +436,12 @@ void StartPageWidget::dropEvent(QDropEvent *event)
 
 		if (urls.isEmpty())
 		{
-			const InputInterpreter::InterpreterResult result(InputInterpreter::interpret(event->mimeData()->text(), (InputInterpreter::NoBookmarkKeywordsFlag | InputInterpreter::NoSearchKeywordsFlag)));
+			InputInterpreter *interpreter(new InputInterpreter(this));
 
-			if (result.isValid())
+			connect(interpreter, &InputInterpreter::finished, this, [=](const InputInterpreter::InterpreterResult &result)
 			{
+				interpreter->deleteLater();
+
 				switch (result.type)
 				{
 					case InputInterpreter::InterpreterResult::UrlType:
@@ -453,7 +455,9 @@ void StartPageWidget::dropEvent(QDropEvent *event)
 					default:
 						break;
 				}
-			}
+			});
+
+			interpreter->start(event->mimeData()->text(), (InputInterpreter::NoBookmarkKeywordsFlag | InputInterpreter::NoSearchKeywordsFlag));
 		}
 		else
 		{
@@ -48,8 +48,11 @@
 #include "../../../ui/WebsiteInformationDialog.h"
 #include "../../../ui/Window.h"
 
+#include <QtCore/QEventLoop>
+#include <QtCore/QSharedPointer>
 #include <QtGui/QClipboard>
 #include <QtGui/QMouseEvent>
+#include <QtPrintSupport/QPrinter>
 #include <QtWidgets/QInputDialog>
 
 namespace Otter
@@ -71,6 +74,7 @@ WebContentsWidget::WebContentsWidget(const QVariantMap &parameters, const QHash<
 	m_popupsBarWidget(nullptr),
 	m_scrollMode(NoScroll),
 	m_createStartPageTimer(0),
+	m_findInPageTimer(0),
 	m_quickFindTimer(0),
 	m_scrollTimer(0),
 	m_isTabPreferencesMenuVisible(false),
@@ -100,6 +104,14 @@ void WebContentsWidget::timerEvent(QTimerEvent *event)
 
 		handleUrlChange(m_webWidget->getRequestedUrl());
 	}
+	else if (event->timerId() == m_findInPageTimer)
+	{
+		killTimer(m_findInPageTimer);
+
+		m_findInPageTimer = 0;
+
+		findInPage(m_searchBarWidget ? m_searchBarWidget->getFlags() : WebWidget::HighlightAllFind);
+	}
 	else if (event->timerId() == m_quickFindTimer)
 	{
 		killTimer(m_quickFindTimer);
@@ -326,7 +338,22 @@ void WebContentsWidget::search(const QString &search, const QString &query)
 
 void WebContentsWidget::print(QPrinter *printer)
 {
-	m_webWidget->print(printer);
+	QEventLoop eventLoop;
+	bool isFinished(false);
+
+	connect(m_webWidget, &WebWidget::destroyed, &eventLoop, &QEventLoop::quit);
+
+	m_webWidget->print(printer, [&](bool)
+	{
+		isFinished = true;
+
+		eventLoop.quit();
+	});
+
+	if (!isFinished)
+	{
+		eventLoop.exec(QEventLoop::ExcludeUserInputEvents);
+	}
 }
 
 void WebContentsWidget::triggerAction(int identifier, const QVariantMap &parameters, ActionsManager::TriggerType trigger)
@@ -591,6 +618,19 @@ void WebContentsWidget::triggerAction(int identifier, const QVariantMap &paramet
 
 			break;
 		case ActionsManager::PrintAction:
+			{
+				QSharedPointer<QPrinter> printer(new QPrinter());
+
+				if (showPrintDialog(printer.data()))
+				{
+					m_webWidget->print(printer.data(), [=](bool) mutable
+					{
+						printer.reset();
+					});
+				}
+			}
+
+			break;
 		case ActionsManager::PrintPreviewAction:
 		case ActionsManager::BookmarkPageAction:
 			ContentsWidget::triggerAction(identifier, parameters, trigger);
@@ -684,6 +724,13 @@ void WebContentsWidget::triggerAction(int identifier, const QVariantMap &paramet
 
 void WebContentsWidget::findInPage(WebWidget::FindFlags flags)
 {
+	if (m_findInPageTimer != 0)
+	{
+		killTimer(m_findInPageTimer);
+
+		m_findInPageTimer = 0;
+	}
+
 	if (m_quickFindTimer != 0)
 	{
 		killTimer(m_quickFindTimer);
@@ -693,17 +740,12 @@ void WebContentsWidget::findInPage(WebWidget::FindFlags flags)
 
 	m_quickFindQuery = (m_searchBarWidget ? m_searchBarWidget->getQuery() : m_sharedQuickFindQuery);
 
-	const int matchesAmount(m_webWidget->findInPage(m_quickFindQuery, flags));
-
 	if (!m_quickFindQuery.isEmpty() && !isPrivate() && SettingsManager::getOption(SettingsManager::Search_ReuseLastQuickFindQueryOption).toBool())
 	{
 		m_sharedQuickFindQuery = m_quickFindQuery;
 	}
 
-	if (m_searchBarWidget)
-	{
-		m_searchBarWidget->setMatchesAmount(matchesAmount);
-	}
+	m_webWidget->findInPage(m_quickFindQuery, flags);
 }
 
 void WebContentsWidget::addInformationBar(QWidget *widget)
@@ -1025,7 +1067,20 @@ void WebContentsWidget::handleLoadingStateChange(WebWidget::LoadingState state)
 
 void WebContentsWidget::handleFindInPageQueryChanged()
 {
-	findInPage(m_searchBarWidget ? m_searchBarWidget->getFlags() : WebWidget::HighlightAllFind);
+	if (m_findInPageTimer != 0)
+	{
+		killTimer(m_findInPageTimer);
+	}
+
+	m_findInPageTimer = startTimer(100);
+}
+
+void WebContentsWidget::handleFindInPageResultsChanged(const QString &query, int matchesAmount)
+{
+	if (m_searchBarWidget && query == m_searchBarWidget->getQuery())
+	{
+		m_searchBarWidget->setMatchesAmount(matchesAmount);
+	}
 }
 
 void WebContentsWidget::notifyPermissionChanged(WebWidget::PermissionPolicies policies)
@@ -1218,6 +1273,7 @@ void WebContentsWidget::setWidget(WebWidget *widget, const QVariantMap &paramete
 	connect(m_webWidget, &WebWidget::urlChanged, this, &WebContentsWidget::handleUrlChange);
 	connect(m_webWidget, &WebWidget::iconChanged, this, &WebContentsWidget::iconChanged);
 	connect(m_webWidget, &WebWidget::requestBlocked, this, &WebContentsWidget::requestBlocked);
+	connect(m_webWidget, &WebWidget::findInPageResultsChanged, this, &WebContentsWidget::handleFindInPageResultsChanged);
 	connect(m_webWidget, &WebWidget::arbitraryActionsStateChanged, this, &WebContentsWidget::arbitraryActionsStateChanged);
 	connect(m_webWidget, &WebWidget::categorizedActionsStateChanged, this, &WebContentsWidget::categorizedActionsStateChanged);
 	connect(m_webWidget, &WebWidget::contentStateChanged, this, &WebContentsWidget::contentStateChanged);
@@ -122,6 +122,7 @@ protected slots:
 	void handleInspectorVisibilityChangeRequest(bool isVisible);
 	void handleLoadingStateChange(WebWidget::LoadingState state);
 	void handleFindInPageQueryChanged();
+	void handleFindInPageResultsChanged(const QString &query, int matchesAmount);
 	void notifyPermissionChanged(WebWidget::PermissionPolicies policies);
 	void notifyRequestedNewWindow(WebWidget *widget, SessionsManager::OpenHints hints, const QVariantMap &parameters);
 	void updateFindHighlight(WebWidget::FindFlags flags);
@@ -143,6 +144,7 @@ private:
 	QVector<PermissionBarWidget*> m_permissionBarWidgets;
 	ScrollMode m_scrollMode;
 	int m_createStartPageTimer;
+	int m_findInPageTimer;
 	int m_quickFindTimer;
 	int m_scrollTimer;
 	bool m_isTabPreferencesMenuVisible;
@@ -123,6 +123,7 @@ void Action::initialize()
 	}
 
 	updateIcon();
+	updateShortcut();
 	updateState();
 
 	connect(ActionsManager::getInstance(), &ActionsManager::shortcutsChanged, this, &Action::updateShortcut);
@@ -146,22 +147,6 @@ void Action::triggerAction(bool isChecked)
 	}
 }
 
-void Action::handleArbitraryActionsStateChanged(const QVector<int> &identifiers)
-{
-	if (identifiers.contains(m_identifier))
-	{
-		updateState();
-	}
-}
-
-void Action::handleCategorizedActionsStateChanged(const QVector<int> &categories)
-{
-	if (categories.contains(getDefinition().category))
-	{
-		updateState();
-	}
-}
-
 void Action::updateIcon()
 {
 	if (!m_flags.testFlag(IsOverridingIconFlag))
@@ -220,7 +205,11 @@ void Action::updateState()
 		state.isEnabled = false;
 	}
 
-	updateShortcut();
+	if (state.text == text() && state.statusTip == statusTip() && state.toolTip == toolTip() && state.isEnabled == isEnabled() && (!isCheckable() || state.isChecked == isChecked()) && (m_flags.testFlag(IsOverridingIconFlag) || state.icon.cacheKey() == icon().cacheKey()))
+	{
+		return;
+	}
+
 	setState(state);
 }
 
@@ -228,13 +217,8 @@ void Action::setExecutor(ActionExecutor::Object executor)
 {
 	const ActionsManager::ActionDefinition definition(getDefinition());
 	const QMetaMethod updateStateMethod(metaObject()->method(metaObject()->indexOfMethod("updateState()")));
-	const QMetaMethod handleArbitraryActionsStateChangedMethod(metaObject()->method(metaObject()->indexOfMethod("handleArbitraryActionsStateChanged(QVector<int>)")));
-	const QMetaMethod handleCategorizedActionsStateChangeddMethod(metaObject()->method(metaObject()->indexOfMethod("handleCategorizedActionsStateChanged(QVector<int>)")));
 
-	if (m_executor.isValid())
-	{
-		m_executor.disconnectSignals(this, &updateStateMethod, &handleArbitraryActionsStateChangedMethod, &handleCategorizedActionsStateChangeddMethod);
-	}
+	m_executor.removeStateReceiver(this);
 
 	if (executor.isValid())
 	{
@@ -274,7 +258,7 @@ void Action::setExecutor(ActionExecutor::Object executor)
 
 	if (executor.isValid())
 	{
-		m_executor.connectSignals(this, &updateStateMethod, &handleArbitraryActionsStateChangedMethod, &handleCategorizedActionsStateChangeddMethod);
+		m_executor.addStateReceiver(this, updateStateMethod, m_identifier, definition.category);
 	}
 }
 
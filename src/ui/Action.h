@@ -59,8 +59,6 @@ protected:
 
 protected slots:
 	void triggerAction(bool isChecked = false);
-	void handleArbitraryActionsStateChanged(const QVector<int> &identifiers);
-	void handleCategorizedActionsStateChanged(const QVector<int> &categories);
 	void updateShortcut();
 	void updateState();
 
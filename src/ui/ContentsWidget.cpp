@@ -142,13 +142,8 @@ void ContentsWidget::triggerAction(int identifier, const QVariantMap &parameters
 		case ActionsManager::PrintAction:
 			{
 				QPrinter printer;
-				printer.setCreator(QStringLiteral("Otter Browser %1").arg(Application::getFullVersion()));
-				printer.setDocName(getTitle());
 
-				QPrintDialog printDialog(&printer, this);
-				printDialog.setWindowTitle(tr("Print Page"));
-
-				if (printDialog.exec() == QDialog::Accepted)
+				if (showPrintDialog(&printer))
 				{
 					print(&printer);
 				}
@@ -440,6 +435,17 @@ int ContentsWidget::getZoom() const
 	return 100;
 }
 
+bool ContentsWidget::showPrintDialog(QPrinter *printer)
+{
+	printer->setCreator(QStringLiteral("Otter Browser %1").arg(Application::getFullVersion()));
+	printer->setDocName(getTitle());
+
+	QPrintDialog printDialog(printer, this);
+	printDialog.setWindowTitle(tr("Print Page"));
+
+	return (printDialog.exec() == QDialog::Accepted);
+}
+
 bool ContentsWidget::canClone() const
 {
 	return false;
@@ -78,6 +78,7 @@ protected:
 	void resizeEvent(QResizeEvent *event) override;
 	void mousePressEvent(QMouseEvent *event) override;
 	void mouseReleaseEvent(QMouseEvent *event) override;
+	bool showPrintDialog(QPrinter *printer);
 
 protected slots:
 	void handleAboutToClose();
@@ -313,6 +313,7 @@ ItemViewWidget::ItemViewWidget(QWidget *parent) : QTreeView(parent),
 	m_sortOrder(Qt::AscendingOrder),
 	m_sortColumn(-1),
 	m_dragRow(-1),
+	m_filterTimer(0),
 	m_canGatherExpanded(false),
 	m_isExclusive(false),
 	m_isModified(false),
@@ -333,6 +334,34 @@ ItemViewWidget::ItemViewWidget(QWidget *parent) : QTreeView(parent),
 	connect(m_headerWidget, &HeaderViewWidget::sectionMoved, this, &ItemViewWidget::saveState);
 }
 
+void ItemViewWidget::timerEvent(QTimerEvent *event)
+{
+	if (event->timerId() == m_filterTimer)
+	{
+		killTimer(m_filterTimer);
+
+		m_filterTimer = 0;
+
+		const QSet<QPersistentModelIndex> parents(m_filterParents);
+
+		m_filterParents.clear();
+
+		QSet<QPersistentModelIndex>::const_iterator iterator;
+
+		for (iterator = parents.constBegin(); iterator != parents.constEnd(); ++iterator)
+		{
+			if ((*iterator).isValid())
+			{
+				updateFilterParents(*iterator);
+			}
+		}
+	}
+	else
+	{
+		QTreeView::timerEvent(event);
+	}
+}
+
 void ItemViewWidget::showEvent(QShowEvent *event)
 {
 	ensureInitialized();
@@ -695,6 +724,122 @@ void ItemViewWidget::notifySelectionChanged()
 	emit needsActionsUpdate();
 }
 
+void ItemViewWidget::scheduleFilterUpdate(const QModelIndex &parent)
+{
+	if (!parent.isValid() || m_filterParents.contains(parent))
+	{
+		return;
+	}
+
+	m_filterParents.insert(parent);
+
+	if (m_filterTimer == 0)
+	{
+		m_filterTimer = startTimer(100);
+	}
+}
+
+void ItemViewWidget::updateFilterParents(const QModelIndex &index)
+{
+	QModelIndex parent(index);
+
+	while (parent.isValid())
+	{
+		const int rowCount(getRowCount(parent));
+		const bool parentHasMatch(hasInheritedFilterMatch(parent.parent()));
+		bool hasMatch(parentHasMatch || hasFilterMatch(parent));
+
+		if (!hasMatch)
+		{
+			for (int i = 0; i < rowCount; ++i)
+			{
+				if (!isRowHidden(i, parent))
+				{
+					hasMatch = true;
+
+					break;
+				}
+			}
+		}
+
+		setRowHidden(parent.row(), parent.parent(), (!hasMatch || rowCount == 0));
+		setExpanded(parent, hasMatch);
+
+		parent = parent.parent();
+	}
+}
+
+void ItemViewWidget::removeFilterTexts(const QModelIndex &parent, int first, int last)
+{
+	for (int i = first; i <= last; ++i)
+	{
+		const QModelIndex index(model()->index(i, 0, parent));
+
+		m_filterTexts.remove(getFilterItem(index));
+
+		if (model()->hasChildren(index))
+		{
+			removeFilterTexts(index, 0, (getRowCount(index) - 1));
+		}
+	}
+}
+
+void ItemViewWidget::handleRowsInserted(const QModelIndex &parent, int first, int last)
+{
+	const bool parentHasMatch(hasInheritedFilterMatch(parent));
+
+	for (int i = first; i <= last; ++i)
+	{
+		applyFilter(model()->index(i, 0, parent), parentHasMatch);
+	}
+
+	scheduleFilterUpdate(parent);
+}
+
+void ItemViewWidget::handleRowsAboutToBeRemoved(const QModelIndex &parent, int first, int last)
+{
+	if (!m_filterTexts.isEmpty())
+	{
+		removeFilterTexts(parent, first, last);
+	}
+}
+
+void ItemViewWidget::handleRowsRemoved(const QModelIndex &parent)
+{
+	scheduleFilterUpdate(parent);
+}
+
+void ItemViewWidget::handleRowsMoved(const QModelIndex &sourceParent, int sourceStart, int sourceEnd, const QModelIndex &destinationParent, int destinationRow)
+{
+	const int amount(sourceEnd - sourceStart + 1);
+	const int first((sourceParent == destinationParent && destinationRow > sourceEnd) ? (destinationRow - amount) : destinationRow);
+
+	handleRowsInserted(destinationParent, first, (first + amount - 1));
+	scheduleFilterUpdate(sourceParent);
+}
+
+void ItemViewWidget::handleDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight)
+{
+	const QModelIndex parent(topLeft.parent());
+	const bool parentHasMatch(hasInheritedFilterMatch(parent));
+
+	for (int i = topLeft.row(); i <= bottomRight.row(); ++i)
+	{
+		const QModelIndex index(model()->index(i, 0, parent));
+
+		m_filterTexts.remove(getFilterItem(index));
+
+		applyFilter(index, parentHasMatch);
+	}
+
+	scheduleFilterUpdate(parent);
+}
+
+void ItemViewWidget::clearFilterTexts()
+{
+	m_filterTexts.clear();
+}
+
 void ItemViewWidget::updateFilter()
 {
 	for (int i = 0; i < getRowCount(); ++i)
@@ -818,36 +963,54 @@ void ItemViewWidget::setExclusive(bool isExclusive)
 
 void ItemViewWidget::setFilterString(const QString &filter)
 {
-	if (filter == m_filterString || !model())
+	const QString filterString(filter.toLower());
+
+	if (filterString == m_filterString || !model())
 	{
 		return;
 	}
 
 	if (m_filterString.isEmpty())
 	{
-		connect(model(), &QAbstractItemModel::rowsInserted, this, &ItemViewWidget::updateFilter);
-		connect(model(), &QAbstractItemModel::rowsMoved, this, &ItemViewWidget::updateFilter);
-		connect(model(), &QAbstractItemModel::rowsRemoved, this, &ItemViewWidget::updateFilter);
+		connect(model(), &QAbstractItemModel::rowsInserted, this, &ItemViewWidget::handleRowsInserted);
+		connect(model(), &QAbstractItemModel::rowsAboutToBeRemoved, this, &ItemViewWidget::handleRowsAboutToBeRemoved);
+		connect(model(), &QAbstractItemModel::rowsRemoved, this, &ItemViewWidget::handleRowsRemoved);
+		connect(model(), &QAbstractItemModel::rowsMoved, this, &ItemViewWidget::handleRowsMoved);
+		connect(model(), &QAbstractItemModel::dataChanged, this, &ItemViewWidget::handleDataChanged);
+		connect(model(), &QAbstractItemModel::modelReset, this, &ItemViewWidget::clearFilterTexts);
 	}
 
 	m_canGatherExpanded = m_filterString.isEmpty();
-	m_filterString = filter;
+	m_filterString = filterString;
 
 	updateFilter();
 
 	if (m_filterString.isEmpty())
 	{
+		if (m_filterTimer != 0)
+		{
+			killTimer(m_filterTimer);
+
+			m_filterTimer = 0;
+		}
+
 		m_expandedBranches.clear();
+		m_filterParents.clear();
+		m_filterTexts.clear();
 
-		disconnect(model(), &QAbstractItemModel::rowsInserted, this, &ItemViewWidget::updateFilter);
-		disconnect(model(), &QAbstractItemModel::rowsMoved, this, &ItemViewWidget::updateFilter);
-		disconnect(model(), &QAbstractItemModel::rowsRemoved, this, &ItemViewWidget::updateFilter);
+		disconnect(model(), &QAbstractItemModel::rowsInserted, this, &ItemViewWidget::handleRowsInserted);
+		disconnect(model(), &QAbstractItemModel::rowsAboutToBeRemoved, this, &ItemViewWidget::handleRowsAboutToBeRemoved);
+		disconnect(model(), &QAbstractItemModel::rowsRemoved, this, &ItemViewWidget::handleRowsRemoved);
+		disconnect(model(), &QAbstractItemModel::rowsMoved, this, &ItemViewWidget::handleRowsMoved);
+		disconnect(model(), &QAbstractItemModel::dataChanged, this, &ItemViewWidget::handleDataChanged);
+		disconnect(model(), &QAbstractItemModel::modelReset, this, &ItemViewWidget::clearFilterTexts);
 	}
 }
 
 void ItemViewWidget::setFilterRoles(const QSet<int> &roles)
 {
 	m_filterRoles = roles;
+	m_filterTexts.clear();
 }
 
 void ItemViewWidget::setData(const QModelIndex &index, const QVariant &value, int role)
@@ -882,6 +1045,7 @@ void ItemViewWidget::setModel(QAbstractItemModel *model, bool useSortProxy)
 	}
 
 	m_sourceModel = qobject_cast<QStandardItemModel*>(model);
+	m_filterTexts.clear();
 
 	QTreeView::setModel(activeModel);
 
@@ -966,6 +1130,18 @@ QStandardItem* ItemViewWidget::getItem(int row, int column, const QModelIndex &p
 	return(m_sourceModel ? m_sourceModel->itemFromIndex(getIndex(row, column, parent)) : nullptr);
 }
 
+QStandardItem* ItemViewWidget::getFilterItem(const QModelIndex &index) const
+{
+	if (!m_sourceModel)
+	{
+		return nullptr;
+	}
+
+	const QModelIndex sourceIndex(m_proxyModel ? m_proxyModel->mapToSource(index) : index);
+
+	return m_sourceModel->itemFromIndex(sourceIndex.sibling(sourceIndex.row(), 0));
+}
+
 QModelIndex ItemViewWidget::getCheckedIndex(const QModelIndex &parent) const
 {
 	if (!m_isExclusive || !m_sourceModel)
@@ -1073,47 +1249,63 @@ bool ItemViewWidget::isExclusive() const
 	return m_isExclusive;
 }
 
-bool ItemViewWidget::applyFilter(const QModelIndex &index, bool parentHasMatch)
+QString ItemViewWidget::getFilterText(const QModelIndex &index)
 {
-	if (!model())
+	const QStandardItem *item(getFilterItem(index));
+
+	if (item && m_filterTexts.contains(item))
 	{
-		return false;
+		return m_filterTexts.value(item);
 	}
 
-	const bool isFolder(!index.flags().testFlag(Qt::ItemNeverHasChildren));
-	const bool hasFilter(!m_filterString.isEmpty());
-	bool hasMatch(!hasFilter || (isFolder && parentHasMatch));
+	QStringList texts;
 
-	if (!hasMatch)
+	for (int i = 0; i < getColumnCount(index.parent()); ++i)
 	{
-		for (int i = 0; i < getColumnCount(index.parent()); ++i)
+		const QModelIndex childIndex(index.sibling(index.row(), i));
+
+		if (!childIndex.isValid())
 		{
-			const QModelIndex childIndex(index.sibling(index.row(), i));
+			continue;
+		}
 
-			if (!childIndex.isValid())
+		QSet<int>::iterator iterator;
+
+		for (iterator = m_filterRoles.begin(); iterator != m_filterRoles.end(); ++iterator)
+		{
+			const QVariant roleData(childIndex.data(*iterator));
+
+			if (!roleData.isNull())
 			{
-				continue;
+				texts.append(roleData.toString().toLower());
 			}
+		}
+	}
 
-			QSet<int>::iterator iterator;
+	const QString text(texts.join(QLatin1Char('\n')));
 
-			for (iterator = m_filterRoles.begin(); iterator != m_filterRoles.end(); ++iterator)
-			{
-				const QVariant roleData(childIndex.data(*iterator));
+	if (item)
+	{
+		m_filterTexts[item] = text;
+	}
 
-				if (!roleData.isNull() && roleData.toString().contains(m_filterString, Qt::CaseInsensitive))
-				{
-					hasMatch = true;
+	return text;
+}
 
-					break;
-				}
-			}
+bool ItemViewWidget::applyFilter(const QModelIndex &index, bool parentHasMatch)
+{
+	if (!model())
+	{
+		return false;
+	}
 
-			if (hasMatch)
-			{
-				break;
-			}
-		}
+	const bool isFolder(!index.flags().testFlag(Qt::ItemNeverHasChildren));
+	const bool hasFilter(!m_filterString.isEmpty());
+	bool hasMatch(!hasFilter || (isFolder && parentHasMatch));
+
+	if (!hasMatch)
+	{
+		hasMatch = hasFilterMatch(index);
 	}
 
 	if (isFolder)
@@ -1150,6 +1342,28 @@ bool ItemViewWidget::applyFilter(const QModelIndex &index, bool parentHasMatch)
 	return hasMatch;
 }
 
+bool ItemViewWidget::hasFilterMatch(const QModelIndex &index)
+{
+	return getFilterText(index).contains(m_filterString);
+}
+
+bool ItemViewWidget::hasInheritedFilterMatch(const QModelIndex &index)
+{
+	QModelIndex parent(index);
+
+	while (parent.isValid())
+	{
+		if (hasFilterMatch(parent))
+		{
+			return true;
+		}
+
+		parent = parent.parent();
+	}
+
+	return false;
+}
+
 bool ItemViewWidget::isModified() const
 {
 	return m_isModified;
@@ -144,6 +144,7 @@ public slots:
 	void setFilterRoles(const QSet<int> &roles);
 
 protected:
+	void timerEvent(QTimerEvent *event) override;
 	void showEvent(QShowEvent *event) override;
 	void resizeEvent(QResizeEvent *event) override;
 	void keyPressEvent(QKeyEvent *event) override;
@@ -152,13 +153,26 @@ protected:
 	void ensureInitialized();
 	void moveRow(bool moveUp);
 	void selectRow(const QModelIndex &index);
+	void scheduleFilterUpdate(const QModelIndex &parent);
+	void updateFilterParents(const QModelIndex &index);
+	void removeFilterTexts(const QModelIndex &parent, int first, int last);
+	QStandardItem* getFilterItem(const QModelIndex &index) const;
+	QString getFilterText(const QModelIndex &index);
 	bool applyFilter(const QModelIndex &index, bool parentHasMatch = false);
+	bool hasFilterMatch(const QModelIndex &index);
+	bool hasInheritedFilterMatch(const QModelIndex &index);
 
 protected slots:
 	void currentChanged(const QModelIndex &current, const QModelIndex &previous) override;
 	void saveState();
 	void handleOptionChanged(int identifier, const QVariant &value);
 	void notifySelectionChanged();
+	void handleRowsInserted(const QModelIndex &parent, int first, int last);
+	void handleRowsAboutToBeRemoved(const QModelIndex &parent, int first, int last);
+	void handleRowsRemoved(const QModelIndex &parent);
+	void handleRowsMoved(const QModelIndex &sourceParent, int sourceStart, int sourceEnd, const QModelIndex &destinationParent, int destinationRow);
+	void handleDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight);
+	void clearFilterTexts();
 	void updateFilter();
 	void updateSize();
 
@@ -169,12 +183,15 @@ private:
 	QSortFilterProxyModel *m_proxyModel;
 	QString m_filterString;
 	QMap<int, int> m_sortRoleMapping;
+	QSet<QPersistentModelIndex> m_filterParents;
+	QHash<const QStandardItem*, QString> m_filterTexts;
 	QSet<QModelIndex> m_expandedBranches;
 	QSet<int> m_filterRoles;
 	ViewMode m_viewMode;
 	Qt::SortOrder m_sortOrder;
 	int m_sortColumn;
 	int m_dragRow;
+	int m_filterTimer;
 	bool m_canGatherExpanded;
 	bool m_isExclusive;
 	bool m_isModified;
@@ -74,6 +74,7 @@ MainWindow::MainWindow(const QVariantMap &parameters, const Session::MainWindow
 	m_currentWindow(nullptr),
 	m_identifier(++m_identifierCounter),
 	m_mouseTrackerTimer(0),
+	m_restoreTimer(0),
 	m_tabSwitchingOrderIndex(-1),
 	m_isAboutToClose(false),
 	m_isDraggingToolBar(false),
@@ -238,7 +239,28 @@ MainWindow::~MainWindow()
 
 void MainWindow::timerEvent(QTimerEvent *event)
 {
-	if (event->timerId() == m_mouseTrackerTimer)
+	if (event->timerId() == m_restoreTimer)
+	{
+		while (!m_deferredWindows.isEmpty())
+		{
+			const QPointer<Window> window(m_deferredWindows.takeFirst());
+
+			if (window && window->isSuspended())
+			{
+				window->resume();
+
+				break;
+			}
+		}
+
+		if (m_deferredWindows.isEmpty())
+		{
+			killTimer(m_restoreTimer);
+
+			m_restoreTimer = 0;
+		}
+	}
+	else if (event->timerId() == m_mouseTrackerTimer)
 	{
 		QVector<Qt::ToolBarArea> areas;
 		const QPoint position(mapFromGlobal(QCursor::pos()));
@@ -619,36 +641,41 @@ void MainWindow::triggerAction(int identifier, const QVariantMap &parameters, Ac
 				{
 					if (parameters.value(QLatin1String("needsInterpretation"), false).toBool())
 					{
-						const InputInterpreter::InterpreterResult result(InputInterpreter::interpret(parameters[QLatin1String("url")].toString(), InputInterpreter::NoBookmarkKeywordsFlag));
+						InputInterpreter *interpreter(new InputInterpreter(this));
 
-						if (!result.isValid())
+						connect(interpreter, &InputInterpreter::finished, this, [=](const InputInterpreter::InterpreterResult &result)
 						{
-							return;
-						}
+							QVariantMap mutableParameters(parameters);
+							mutableParameters.remove(QLatin1String("needsInterpretation"));
 
-						switch (result.type)
-						{
-							case InputInterpreter::InterpreterResult::BookmarkType:
-								{
-									QVariantMap mutableParameters(parameters);
-									mutableParameters.remove(QLatin1String("needsInterpretation"));
+							interpreter->deleteLater();
+
+							switch (result.type)
+							{
+								case InputInterpreter::InterpreterResult::BookmarkType:
 									mutableParameters[QLatin1String("bookmark")] = result.bookmark->getIdentifier();
 
 									triggerAction(ActionsManager::OpenBookmarkAction, mutableParameters, trigger);
-								}
 
-								return;
-							case InputInterpreter::InterpreterResult::UrlType:
-								url = result.url;
+									break;
+								case InputInterpreter::InterpreterResult::UrlType:
+									mutableParameters[QLatin1String("url")] = result.url;
 
-								break;
-							case InputInterpreter::InterpreterResult::SearchType:
-								search(result.searchQuery, result.searchEngine, SessionsManager::calculateOpenHints(parameters, (trigger == ActionsManager::KeyboardTrigger || trigger == ActionsManager::MouseTrigger)));
+									triggerAction(ActionsManager::OpenUrlAction, mutableParameters, trigger);
 
-								return;
-							default:
-								return;
-						}
+									break;
+								case InputInterpreter::InterpreterResult::SearchType:
+									search(result.searchQuery, result.searchEngine, SessionsManager::calculateOpenHints(parameters, (trigger == ActionsManager::KeyboardTrigger || trigger == ActionsManager::MouseTrigger)));
+
+									break;
+								default:
+									break;
+							}
+						});
+
+						interpreter->start(parameters[QLatin1String("url")].toString(), InputInterpreter::NoBookmarkKeywordsFlag);
+
+						return;
 					}
 					else
 					{
@@ -1306,6 +1333,8 @@ void MainWindow::restoreSession(const Session::MainWindow &session)
 	}
 	else
 	{
+		const bool deferLoading(SettingsManager::getOption(SettingsManager::Sessions_DeferTabsLoadingOption).toBool());
+
 		for (int i = 0; i < session.windows.count(); ++i)
 		{
 			QVariantMap parameters({{QLatin1String("size"), ((session.windows.at(i).state.state == Qt::WindowMaximized || !session.windows.at(i).state.geometry.isValid()) ? m_workspace->size() : session.windows.at(i).state.geometry.size())}});
@@ -1316,7 +1345,12 @@ void MainWindow::restoreSession(const Session::MainWindow &session)
 			}
 
 			Window *window(new Window(parameters, nullptr, this));
-			window->setSession(session.windows.at(i), SettingsManager::getOption(SettingsManager::Sessions_DeferTabsLoadingOption).toBool());
+			window->setSession(session.windows.at(i), true);
+
+			if (!deferLoading)
+			{
+				m_deferredWindows.append(window);
+			}
 
 			if (index < 0 && session.windows.at(i).state.state != Qt::WindowMinimized)
 			{
@@ -1333,6 +1367,11 @@ void MainWindow::restoreSession(const Session::MainWindow &session)
 
 	setActiveWindowByIndex(index);
 
+	if (!m_deferredWindows.isEmpty() && m_restoreTimer == 0)
+	{
+		m_restoreTimer = startTimer(100);
+	}
+
 	m_workspace->markAsRestored();
 
 	emit sessionRestored();
@@ -1776,8 +1815,14 @@ void MainWindow::handleWindowIsPinnedChanged(bool isPinned)
 		return;
 	}
 
+	const int index(getWindowIndex(modifiedWindow->getIdentifier()));
+
+	if (index < 0)
+	{
+		return;
+	}
+
 	int amountOfLeadingPinnedTabs(0);
-	int index(-1);
 
 	for (int i = 0; i < m_windows.count(); ++i)
 	{
@@ -1793,21 +1838,6 @@ void MainWindow::handleWindowIsPinnedChanged(bool isPinned)
 		}
 	}
 
-	for (int i = 0; i < m_windows.count(); ++i)
-	{
-		if (getWindowByIndex(i) == modifiedWindow)
-		{
-			index = i;
-
-			break;
-		}
-	}
-
-	if (index < 0)
-	{
-		return;
-	}
-
 	if (!isPinned && index < amountOfLeadingPinnedTabs)
 	{
 		--amountOfLeadingPinnedTabs;
@@ -2487,7 +2517,7 @@ ActionsManager::ActionDefinition::State MainWindow::getActionState(int identifie
 	return state;
 }
 
-Session::MainWindow MainWindow::getSession() const
+Session::MainWindow MainWindow::getSession(bool includeWindows) const
 {
 	const QVector<Qt::ToolBarArea> areas({Qt::LeftToolBarArea, Qt::RightToolBarArea, Qt::TopToolBarArea, Qt::BottomToolBarArea});
 	Session::MainWindow session;
@@ -2515,6 +2545,11 @@ Session::MainWindow MainWindow::getSession() const
 
 	session.toolBars.squeeze();
 
+	if (!includeWindows)
+	{
+		return session;
+	}
+
 	for (int i = 0; i < m_windows.count(); ++i)
 	{
 		const Window *window(getWindowByIndex(i));
@@ -2630,17 +2665,7 @@ int MainWindow::getWindowCount() const
 
 int MainWindow::getWindowIndex(quint64 identifier) const
 {
-	for (int i = 0; i < m_windows.count(); ++i)
-	{
-		const Window *window(getWindowByIndex(i));
-
-		if (window && window->getIdentifier() == identifier)
-		{
-			return i;
-		}
-	}
-
-	return -1;
+	return m_tabBar->getWindowIndex(identifier);
 }
 
 bool MainWindow::hasUrl(const QUrl &url, bool activate)
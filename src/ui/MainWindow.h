@@ -71,7 +71,7 @@ public:
 	QString getTitle() const;
 	QUrl getUrl() const;
 	ActionsManager::ActionDefinition::State getActionState(int identifier, const QVariantMap &parameters = {}) const override;
-	Session::MainWindow getSession() const;
+	Session::MainWindow getSession(bool includeWindows = true) const;
 	Session::MainWindow::ToolBarState getToolBarState(int identifier) const;
 	QVector<ToolBarWidget*> getToolBars(Qt::ToolBarArea area) const;
 	QVector<Session::ClosedWindow> getClosedWindows() const;
@@ -140,6 +140,7 @@ private:
 	ActionExecutor::Object m_editorExecutor;
 	QVector<Shortcut*> m_shortcuts;
 	QVector<Window*> m_privateWindows;
+	QVector<QPointer<Window> > m_deferredWindows;
 	QVector<Session::ClosedWindow> m_closedWindows;
 	QVector<quint64> m_tabSwitchingOrderList;
 	QHash<quint64, Window*> m_windows;
@@ -150,6 +151,7 @@ private:
 	Qt::WindowStates m_previousRaisedState;
 	quint64 m_identifier;
 	int m_mouseTrackerTimer;
+	int m_restoreTimer;
 	int m_tabSwitchingOrderIndex;
 	bool m_isAboutToClose;
 	bool m_isDraggingToolBar;
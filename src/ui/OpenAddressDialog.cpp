@@ -31,6 +31,7 @@ namespace Otter
 
 OpenAddressDialog::OpenAddressDialog(const ActionExecutor::Object &executor, QWidget *parent) : Dialog(parent),
 	m_addressWidget(nullptr),
+	m_inputInterpreter(new InputInterpreter(this)),
 	m_executor(executor),
 	m_ui(new Ui::OpenAddressDialog)
 {
@@ -42,7 +43,8 @@ OpenAddressDialog::OpenAddressDialog(const ActionExecutor::Object &executor, QWi
 	m_ui->verticalLayout->insertWidget(1, m_addressWidget);
 	m_ui->label->setBuddy(m_addressWidget);
 
-	connect(this, &OpenAddressDialog::accepted, this, &OpenAddressDialog::handleUserInput);
+	connect(m_addressWidget, &AddressWidget::textEdited, m_inputInterpreter, &InputInterpreter::cancel);
+	connect(m_inputInterpreter, &InputInterpreter::finished, this, &OpenAddressDialog::handleUserInput);
 }
 
 OpenAddressDialog::~OpenAddressDialog()
@@ -74,33 +76,42 @@ void OpenAddressDialog::keyPressEvent(QKeyEvent *event)
 	}
 }
 
-void OpenAddressDialog::handleUserInput()
+void OpenAddressDialog::accept()
 {
 	const QString text(m_addressWidget->text().trimmed());
 
-	if (!text.isEmpty())
+	if (text.isEmpty())
 	{
-		m_result = InputInterpreter::interpret(text, InputInterpreter::NoBookmarkKeywordsFlag);
+		Dialog::accept();
+	}
+	else
+	{
+		m_inputInterpreter->start(text, InputInterpreter::NoBookmarkKeywordsFlag);
+	}
+}
 
-		if (m_result.isValid() && m_executor.isValid())
+void OpenAddressDialog::handleUserInput(const InputInterpreter::InterpreterResult &result)
+{
+	m_result = result;
+
+	if (m_result.isValid() && m_executor.isValid())
+	{
+		switch (m_result.type)
 		{
-			switch (m_result.type)
-			{
-				case InputInterpreter::InterpreterResult::BookmarkType:
-					m_executor.triggerAction(ActionsManager::OpenBookmarkAction, {{QLatin1String("bookmark"), m_result.bookmark->getIdentifier()}, {QLatin1String("hints"), QVariant(SessionsManager::calculateOpenHints(SessionsManager::CurrentTabOpen))}});
-
-					break;
-				case InputInterpreter::InterpreterResult::UrlType:
-					m_executor.triggerAction(ActionsManager::OpenUrlAction, {{QLatin1String("url"), m_result.url}, {QLatin1String("hints"), QVariant(SessionsManager::calculateOpenHints(SessionsManager::CurrentTabOpen))}});
-
-					break;
-				default:
-					break;
-			}
+			case InputInterpreter::InterpreterResult::BookmarkType:
+				m_executor.triggerAction(ActionsManager::OpenBookmarkAction, {{QLatin1String("bookmark"), m_result.bookmark->getIdentifier()}, {QLatin1String("hints"), QVariant(SessionsManager::calculateOpenHints(SessionsManager::CurrentTabOpen))}});
+
+				break;
+			case InputInterpreter::InterpreterResult::UrlType:
+				m_executor.triggerAction(ActionsManager::OpenUrlAction, {{QLatin1String("url"), m_result.url}, {QLatin1String("hints"), QVariant(SessionsManager::calculateOpenHints(SessionsManager::CurrentTabOpen))}});
+
+				break;
+			default:
+				break;
 		}
 	}
 
-	close();
+	Dialog::accept();
 }
 
 void OpenAddressDialog::setText(const QString &text)
@@ -46,15 +46,19 @@ public:
 	void setText(const QString &text);
 	InputInterpreter::InterpreterResult getResult() const;
 
+public slots:
+	void accept() override;
+
 protected:
 	void changeEvent(QEvent *event) override;
 	void keyPressEvent(QKeyEvent *event) override;
 
 protected slots:
-	void handleUserInput();
+	void handleUserInput(const InputInterpreter::InterpreterResult &result);
 
 private:
 	AddressWidget *m_addressWidget;
+	InputInterpreter *m_inputInterpreter;
 	ActionExecutor::Object m_executor;
 	InputInterpreter::InterpreterResult m_result;
 	Ui::OpenAddressDialog *m_ui;
@@ -257,9 +257,16 @@ void SourceViewerWebWidget::triggerAction(int identifier, const QVariantMap &par
 	}
 }
 
-void SourceViewerWebWidget::print(QPrinter *printer)
+void SourceViewerWebWidget::print(QPrinter *printer, const std::function<void(bool)> &callback)
 {
 	m_sourceViewer->print(printer);
+
+	callback(true);
+}
+
+void SourceViewerWebWidget::findInPage(const QString &text, WebWidget::FindFlags flags)
+{
+	emit findInPageResultsChanged(text, m_sourceViewer->findText(text, flags));
 }
 
 void SourceViewerWebWidget::handleViewSourceReplyFinished()
@@ -277,7 +284,7 @@ void SourceViewerWebWidget::handleViewSourceReplyFinished()
 
 void SourceViewerWebWidget::handleZoomChanged()
 {
-	SessionsManager::markSessionAsModified();
+	SessionsManager::markSessionAsModified(getWindowIdentifier());
 }
 
 void SourceViewerWebWidget::notifyEditingActionsStateChanged()
@@ -353,7 +360,7 @@ void SourceViewerWebWidget::setZoom(int zoom)
 	{
 		m_sourceViewer->setZoom(zoom);
 
-		SessionsManager::markSessionAsModified();
+		SessionsManager::markSessionAsModified(getWindowIdentifier());
 
 		emit zoomChanged(zoom);
 	}
@@ -399,11 +406,11 @@ void SourceViewerWebWidget::setContents(const QByteArray &contents, const QStrin
 
 	if (codec)
 	{
-		m_sourceViewer->setPlainText(codec->toUnicode(contents));
+		m_sourceViewer->setContents(codec->toUnicode(contents));
 	}
 	else
 	{
-		m_sourceViewer->setPlainText(QString(contents));
+		m_sourceViewer->setContents(QString(contents));
 	}
 
 	m_sourceViewer->document()->setModified(false);
@@ -522,11 +529,6 @@ int SourceViewerWebWidget::getZoom() const
 	return m_sourceViewer->getZoom();
 }
 
-int SourceViewerWebWidget::findInPage(const QString &text, WebWidget::FindFlags flags)
-{
-	return m_sourceViewer->findText(text, flags);
-}
-
 bool SourceViewerWebWidget::canRedo() const
 {
 	return m_sourceViewer->document()->isRedoAvailable();
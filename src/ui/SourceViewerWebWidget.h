@@ -37,7 +37,8 @@ class SourceViewerWebWidget final : public WebWidget
 public:
 	explicit SourceViewerWebWidget(bool isPrivate, ContentsWidget *parent = nullptr);
 
-	void print(QPrinter *printer) override;
+	void print(QPrinter *printer, const std::function<void(bool)> &callback) override;
+	void findInPage(const QString &text, FindFlags flags = NoFlagsFind) override;
 	WebWidget* clone(bool cloneHistory = true, bool isPrivate = false, const QStringList &excludedOptions = {}) const override;
 	QString getTitle() const override;
 	QString getSelectedText() const override;
@@ -49,7 +50,6 @@ public:
 	HitTestResult getHitTestResult(const QPoint &position) override;
 	WebWidget::LoadingState getLoadingState() const override;
 	int getZoom() const override;
-	int findInPage(const QString &text, FindFlags flags = NoFlagsFind) override;
 	bool canRedo() const override;
 	bool canUndo() const override;
 	bool hasSelection() const override;
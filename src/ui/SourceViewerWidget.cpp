@@ -20,10 +20,12 @@
 #include "SourceViewerWidget.h"
 #include "../core/SettingsManager.h"
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QMetaEnum>
+#include <QtCore/QTimerEvent>
 #include <QtGui/QPainter>
 #include <QtGui/QTextBlock>
 #include <QtWidgets/QScrollBar>
@@ -33,7 +35,10 @@ namespace Otter
 
 QMap<SyntaxHighlighter::HighlightingSyntax, QMap<SyntaxHighlighter::HighlightingState, QTextCharFormat> > SyntaxHighlighter::m_formats;
 
-SyntaxHighlighter::SyntaxHighlighter(QTextDocument *parent) : QSyntaxHighlighter(parent)
+SyntaxHighlighter::SyntaxHighlighter(QTextDocument *parent) : QSyntaxHighlighter(parent),
+	m_highlightTimer(0),
+	m_highlightedBlock(-1),
+	m_isHighlightingDeferred(false)
 {
 	if (m_formats[HtmlSyntax].isEmpty())
 	{
@@ -93,116 +98,182 @@ SyntaxHighlighter::SyntaxHighlighter(QTextDocument *parent) : QSyntaxHighlighter
 	}
 }
 
-void SyntaxHighlighter::highlightBlock(const QString &text)
+void SyntaxHighlighter::timerEvent(QTimerEvent *event)
 {
-	QString buffer;
-	BlockData currentData;
-	HighlightingState previousState(static_cast<HighlightingState>(qMax(previousBlockState(), 0)));
-	HighlightingState currentState(previousState);
-	int previousStateBegin(0);
-	int currentStateBegin(0);
-	int position(0);
-
-	if (currentBlock().previous().userData())
+	if (event->timerId() == m_highlightTimer)
 	{
-		currentData = *static_cast<BlockData*>(currentBlock().previous().userData());
-	}
+		QElapsedTimer timer;
+		timer.start();
 
-	while (position < text.length())
-	{
-		buffer.append(text.at(position));
+		QTextBlock block(document()->findBlockByNumber(m_highlightedBlock + 1));
 
-		++position;
+		while (block.isValid() && !timer.hasExpired(20))
+		{
+			m_highlightedBlock = block.blockNumber();
 
-		const bool isEndOfLine(position == text.length());
+			rehighlightBlock(block);
 
-		if (currentState == NoState && text.at(position - 1) == QLatin1Char('<'))
-		{
-			currentState = KeywordState;
-			currentStateBegin = (position - 1);
-		}
-		else if ((currentState == KeywordState || currentState == DoctypeState) && text.at(position - 1) == QLatin1Char('>'))
-		{
-			currentState = NoState;
-			currentStateBegin = position;
-		}
-		else if (currentState == AttributeState && text.length() > position && text.at(position) == QLatin1Char('>'))
-		{
-			currentState = KeywordState;
-			currentStateBegin = position;
-		}
-		else if (currentState == KeywordState && buffer.compare(QLatin1String("!DOCTYPE"), Qt::CaseInsensitive) == 0)
-		{
-			currentState = DoctypeState;
-		}
-		else if (currentState == KeywordState && buffer == QLatin1String("![CDATA["))
-		{
-			currentState = CharacterDataState;
-		}
-		else if (currentState == CharacterDataState && buffer.endsWith(QLatin1String("]]>")))
-		{
-			currentState = NoState;
-			currentStateBegin = position;
-		}
-		else if (currentState == KeywordState && buffer == QLatin1String("!--"))
-		{
-			currentState = CommentState;
-		}
-		else if (currentState == CommentState && buffer.endsWith(QLatin1String("-->")))
-		{
-			currentState = NoState;
-			currentStateBegin = position;
+			block = block.next();
 		}
-		else if (currentState == KeywordState && (text.at(position - 1) == QLatin1Char('-') || text.at(position - 1).isLetter() || text.at(position - 1).isNumber()) && (position == 1 || (position > 1 && text.at(position - 2).isSpace())))
-		{
-			currentState = AttributeState;
-			currentStateBegin = (position - 1);
-		}
-		else if (currentState == AttributeState && !(text.at(position - 1) == QLatin1Char('-') || text.at(position - 1).isLetter() || text.at(position - 1).isNumber()))
-		{
-			currentState = KeywordState;
-			currentStateBegin = (position - 1);
-		}
-		else if ((currentState == KeywordState || currentState == DoctypeState || currentState == AttributeState) && (text.at(position - 1) == QLatin1Char('\'') || text.at(position - 1) == QLatin1Char('"')))
+
+		if (!block.isValid())
 		{
-			currentData.context = text.at(position - 1);
-			currentData.state = currentState;
-			currentState = ValueState;
-			currentStateBegin = (position - 1);
+			setHighlightingDeferred(false);
 		}
-		else if (currentState == ValueState && text.at(position - 1) == currentData.context)
+	}
+}
+
+void SyntaxHighlighter::highlightBlock(const QString &text)
+{
+	if (m_isHighlightingDeferred && currentBlock().blockNumber() > m_highlightedBlock)
+	{
+		setCurrentBlockState(-1);
+
+		return;
+	}
+
+	const QMap<HighlightingState, QTextCharFormat> formats(m_formats.value(HtmlSyntax));
+	const int blockState(qMax(previousBlockState(), 0));
+	HighlightingState currentState(static_cast<HighlightingState>(blockState & 0xFF));
+	HighlightingState valueState(static_cast<HighlightingState>((blockState >> 8) & 0xFF));
+	QChar valueQuote(static_cast<ushort>(blockState >> 16));
+	int currentStateBegin(0);
+	int contentsBegin(0);
+
+	for (int i = 0; i < text.length(); ++i)
+	{
+		const QChar character(text.at(i));
+		HighlightingState nextState(currentState);
+		int nextStateBegin(i);
+
+		switch (currentState)
 		{
-			currentState = currentData.state;
-			currentStateBegin = position;
-			currentData.context.clear();
-			currentData.state = NoState;
+			case NoState:
+				if (character == QLatin1Char('<'))
+				{
+					const QStringRef tag(text.midRef(i + 1));
+
+					if (tag.startsWith(QLatin1String("!--")))
+					{
+						nextState = CommentState;
+						contentsBegin = (i + 4);
+					}
+					else if (tag.startsWith(QLatin1String("![CDATA[")))
+					{
+						nextState = CharacterDataState;
+						contentsBegin = (i + 9);
+					}
+					else if (tag.startsWith(QLatin1String("!DOCTYPE"), Qt::CaseInsensitive))
+					{
+						nextState = DoctypeState;
+					}
+					else
+					{
+						nextState = KeywordState;
+					}
+				}
+
+				break;
+			case DoctypeState:
+			case KeywordState:
+				if (character == QLatin1Char('>'))
+				{
+					nextState = NoState;
+					nextStateBegin = (i + 1);
+				}
+				else if (character == QLatin1Char('\'') || character == QLatin1Char('"'))
+				{
+					nextState = ValueState;
+					valueState = currentState;
+					valueQuote = character;
+				}
+				else if (currentState == KeywordState && isNameCharacter(character) && (i == 0 || text.at(i - 1).isSpace()))
+				{
+					nextState = AttributeState;
+				}
+
+				break;
+			case AttributeState:
+				if (character == QLatin1Char('\'') || character == QLatin1Char('"'))
+				{
+					nextState = ValueState;
+					valueState = currentState;
+					valueQuote = character;
+				}
+				else if (!isNameCharacter(character))
+				{
+					nextState = KeywordState;
+				}
+				else if ((i + 1) < text.length() && text.at(i + 1) == QLatin1Char('>'))
+				{
+					nextState = KeywordState;
+					nextStateBegin = (i + 1);
+				}
+
+				break;
+			case ValueState:
+				if (character == valueQuote)
+				{
+					nextState = valueState;
+					nextStateBegin = (i + 1);
+					valueState = NoState;
+					valueQuote = QChar();
+				}
+
+				break;
+			case CharacterDataState:
+				if (character == QLatin1Char('>') && i >= (contentsBegin + 2) && text.at(i - 1) == QLatin1Char(']') && text.at(i - 2) == QLatin1Char(']'))
+				{
+					nextState = NoState;
+					nextStateBegin = (i + 1);
+				}
+
+				break;
+			case CommentState:
+				if (character == QLatin1Char('>') && i >= (contentsBegin + 2) && text.at(i - 1) == QLatin1Char('-') && text.at(i - 2) == QLatin1Char('-'))
+				{
+					nextState = NoState;
+					nextStateBegin = (i + 1);
+				}
+
+				break;
+			default:
+				break;
 		}
 
-		if (previousState != currentState || isEndOfLine)
+		if (nextState != currentState)
 		{
-			setFormat(previousStateBegin, (position - previousStateBegin), m_formats[HtmlSyntax][previousState]);
-
-			if (isEndOfLine)
-			{
-				setFormat(currentStateBegin, (position - currentStateBegin), m_formats[HtmlSyntax][currentState]);
-			}
+			setFormat(currentStateBegin, (nextStateBegin - currentStateBegin), formats.value(currentState));
 
-			buffer.clear();
-			previousState = currentState;
-			previousStateBegin = currentStateBegin;
+			currentState = nextState;
+			currentStateBegin = nextStateBegin;
 		}
 	}
 
-	if (!currentData.context.isEmpty())
+	setFormat(currentStateBegin, (text.length() - currentStateBegin), formats.value(currentState));
+	setCurrentBlockState(currentState | (valueState << 8) | (valueQuote.unicode() << 16));
+}
+
+void SyntaxHighlighter::setHighlightingDeferred(bool isDeferred)
+{
+	m_isHighlightingDeferred = isDeferred;
+	m_highlightedBlock = -1;
+
+	if (isDeferred && m_highlightTimer == 0)
+	{
+		m_highlightTimer = startTimer(0);
+	}
+	else if (!isDeferred && m_highlightTimer != 0)
 	{
-		BlockData *nextBlockData(new BlockData());
-		nextBlockData->context = currentData.context;
-		nextBlockData->state = currentData.state;
+		killTimer(m_highlightTimer);
 
-		setCurrentBlockUserData(nextBlockData);
+		m_highlightTimer = 0;
 	}
+}
 
-	setCurrentBlockState(currentState);
+bool SyntaxHighlighter::isNameCharacter(QChar character)
+{
+	return (character == QLatin1Char('-') || character.isLetterOrNumber());
 }
 
 MarginWidget::MarginWidget(SourceViewerWidget *parent) : QWidget(parent),
@@ -328,13 +399,12 @@ bool MarginWidget::event(QEvent *event)
 }
 
 SourceViewerWidget::SourceViewerWidget(QWidget *parent) : QPlainTextEdit(parent),
+	m_highlighter(new SyntaxHighlighter(document())),
 	m_marginWidget(nullptr),
 	m_findFlags(WebWidget::NoFlagsFind),
 	m_findTextResultsAmount(0),
 	m_zoom(100)
 {
-	new SyntaxHighlighter(document());
-
 	setZoom(SettingsManager::getOption(SettingsManager::Content_DefaultZoomOption).toInt());
 	handleOptionChanged(SettingsManager::Interface_ShowScrollBarsOption, SettingsManager::getOption(SettingsManager::Interface_ShowScrollBarsOption));
 	handleOptionChanged(SettingsManager::SourceViewer_ShowLineNumbersOption, SettingsManager::getOption(SettingsManager::SourceViewer_ShowLineNumbersOption));
@@ -476,6 +546,13 @@ void SourceViewerWidget::updateSelection()
 	setExtraSelections(extraSelections);
 }
 
+void SourceViewerWidget::setContents(const QString &contents)
+{
+	m_highlighter->setHighlightingDeferred(contents.length() > 1048576);
+
+	setPlainText(contents);
+}
+
 void SourceViewerWidget::setZoom(int zoom)
 {
 	if (zoom != m_zoom)
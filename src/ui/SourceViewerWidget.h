@@ -55,20 +55,20 @@ public:
 
 	Q_ENUM(HighlightingState)
 
-	struct BlockData final : public QTextBlockUserData
-	{
-		QString context;
-		HighlightingSyntax currentSyntax = HtmlSyntax;
-		HighlightingSyntax previousSyntax = HtmlSyntax;
-		HighlightingState state = NoState;
-	};
-
 	explicit SyntaxHighlighter(QTextDocument *parent);
 
+	void setHighlightingDeferred(bool isDeferred);
+
 protected:
+	void timerEvent(QTimerEvent *event) override;
 	void highlightBlock(const QString &text) override;
+	static bool isNameCharacter(QChar character);
 
 private:
+	int m_highlightTimer;
+	int m_highlightedBlock;
+	bool m_isHighlightingDeferred;
+
 	static QMap<HighlightingSyntax, QMap<HighlightingState, QTextCharFormat> > m_formats;
 };
 
@@ -104,6 +104,7 @@ class SourceViewerWidget final : public QPlainTextEdit
 public:
 	explicit SourceViewerWidget(QWidget *parent = nullptr);
 
+	void setContents(const QString &contents);
 	void setZoom(int zoom);
 	int getZoom() const;
 	int findText(const QString &text, WebWidget::FindFlags flags = WebWidget::NoFlagsFind);
@@ -119,6 +120,7 @@ protected slots:
 	void updateSelection();
 
 private:
+	SyntaxHighlighter *m_highlighter;
 	MarginWidget *m_marginWidget;
 	QString m_findText;
 	QTextCursor m_findTextAnchor;
@@ -32,6 +32,7 @@
 #include "../core/InputInterpreter.h"
 #include "../core/SettingsManager.h"
 #include "../core/ThemesManager.h"
+#include "../core/ThumbnailsManager.h"
 
 #include <QtCore/QMimeData>
 #include <QtCore/QtMath>
@@ -63,6 +64,7 @@ TabHandleWidget::TabHandleWidget(Window *window, TabBarWidget *parent) : QWidget
 	m_tabBarWidget(parent),
 	m_dragTimer(0),
 	m_isActiveWindow(false),
+	m_isNeedingAttention(false),
 	m_isCloseButtonUnderMouse(false),
 	m_wasCloseButtonPressed(false)
 {
@@ -70,13 +72,19 @@ TabHandleWidget::TabHandleWidget(Window *window, TabBarWidget *parent) : QWidget
 	setAcceptDrops(true);
 	setMouseTracking(true);
 
-	connect(window, &Window::needsAttention, this, &TabHandleWidget::markAsNeedingAttention);
 	connect(window, &Window::titleChanged, this, &TabHandleWidget::updateTitle);
 	connect(window, &Window::iconChanged, this, static_cast<void(TabHandleWidget::*)()>(&TabHandleWidget::update));
 	connect(window, &Window::loadingStateChanged, this, &TabHandleWidget::handleLoadingStateChanged);
 	connect(parent, &TabBarWidget::currentChanged, this, &TabHandleWidget::updateGeometries);
 	connect(parent, &TabBarWidget::tabsAmountChanged, this, &TabHandleWidget::updateGeometries);
 	connect(parent, &TabBarWidget::needsGeometriesUpdate, this, &TabHandleWidget::updateGeometries);
+	connect(ThumbnailsManager::getInstance(), &ThumbnailsManager::thumbnailChanged, this, [&](quint64 identifier)
+	{
+		if (m_thumbnailRectangle.isValid() && m_window && m_window->getIdentifier() == identifier)
+		{
+			update();
+		}
+	});
 }
 
 void TabHandleWidget::timerEvent(QTimerEvent *event)
@@ -156,7 +164,7 @@ void TabHandleWidget::paintEvent(QPaintEvent *event)
 
 	if (m_thumbnailRectangle.isValid())
 	{
-		const QPixmap thumbnail(m_window->createThumbnail());
+		const QPixmap thumbnail(ThumbnailsManager::getThumbnail(m_window));
 
 		if (thumbnail.isNull())
 		{
@@ -299,6 +307,8 @@ void TabHandleWidget::markAsNeedingAttention()
 {
 	if (!m_isActiveWindow)
 	{
+		m_isNeedingAttention = true;
+
 		QFont font(parentWidget()->font());
 		font.setBold(true);
 
@@ -563,6 +573,8 @@ void TabHandleWidget::setIsActiveWindow(bool isActive)
 
 		if (isActive)
 		{
+			m_isNeedingAttention = false;
+
 			setFont(parentWidget()->font());
 			updateTitle();
 		}
@@ -578,6 +590,11 @@ Window* TabHandleWidget::getWindow() const
 	return m_window;
 }
 
+bool TabHandleWidget::isNeedingAttention() const
+{
+	return m_isNeedingAttention;
+}
+
 TabBarWidget::TabBarWidget(QWidget *parent) : QTabBar(parent),
 	m_previewWidget(nullptr),
 	m_activeTabHandleWidget(nullptr),
@@ -587,6 +604,7 @@ TabBarWidget::TabBarWidget(QWidget *parent) : QTabBar(parent),
 	m_hoveredTab(-1),
 	m_pinnedTabsAmount(0),
 	m_previewTimer(0),
+	m_tabHandleWidgetsTimer(0),
 	m_arePreviewsEnabled(SettingsManager::getOption(SettingsManager::TabBar_EnablePreviewsOption).toBool()),
 	m_isDraggingTab(false),
 	m_isDetachingTab(false),
@@ -623,7 +641,17 @@ TabBarWidget::TabBarWidget(QWidget *parent) : QTabBar(parent),
 
 	connect(SettingsManager::getInstance(), &SettingsManager::optionChanged, this, &TabBarWidget::handleOptionChanged);
 	connect(ThemesManager::getInstance(), &ThemesManager::widgetStyleChanged, this, &TabBarWidget::updateStyle);
+	connect(ThumbnailsManager::getInstance(), &ThumbnailsManager::thumbnailChanged, this, [&](quint64 identifier)
+	{
+		const Window *window(getWindow(m_hoveredTab));
+
+		if (m_previewWidget && m_previewWidget->isVisible() && window && window->getIdentifier() == identifier)
+		{
+			showPreview(m_hoveredTab);
+		}
+	});
 	connect(this, &TabBarWidget::currentChanged, this, &TabBarWidget::handleCurrentChanged);
+	connect(this, &TabBarWidget::tabMoved, this, &TabBarWidget::handleTabMoved);
 }
 
 void TabBarWidget::changeEvent(QEvent *event)
@@ -671,17 +699,39 @@ void TabBarWidget::timerEvent(QTimerEvent *event)
 
 		showPreview(tabAt(mapFromGlobal(QCursor::pos())));
 	}
+	else if (event->timerId() == m_tabHandleWidgetsTimer)
+	{
+		killTimer(m_tabHandleWidgetsTimer);
+
+		m_tabHandleWidgetsTimer = 0;
+
+		updateTabHandleWidgets();
+	}
 }
 
 void TabBarWidget::paintEvent(QPaintEvent *event)
 {
-	Q_UNUSED(event)
-
 	QStylePainter painter(this);
 	const int selectedIndex(currentIndex());
+	int firstIndex(findTab(event->rect().topLeft()));
+	int lastIndex(findTab(event->rect().bottomRight()));
+	bool needsTabHandleWidgetsUpdate(false);
+
+	if (firstIndex > lastIndex)
+	{
+		qSwap(firstIndex, lastIndex);
+	}
 
-	for (int i = 0; i < count(); ++i)
+	firstIndex = qMax(0, (firstIndex - 1));
+	lastIndex = qMin((count() - 1), (lastIndex + 1));
+
+	for (int i = firstIndex; i <= lastIndex; ++i)
 	{
+		if (!tabButton(i, QTabBar::LeftSide))
+		{
+			needsTabHandleWidgetsUpdate = true;
+		}
+
 		if (i == selectedIndex)
 		{
 			continue;
@@ -735,6 +785,11 @@ void TabBarWidget::paintEvent(QPaintEvent *event)
 			Application::getStyle()->drawDropZone(((shape() == QTabBar::RoundedNorth || shape() == QTabBar::RoundedSouth) ? QLine(lineOffset, 0, lineOffset, height()) : QLine(0, lineOffset, width(), lineOffset)), &painter);
 		}
 	}
+
+	if (needsTabHandleWidgetsUpdate && m_tabHandleWidgetsTimer == 0)
+	{
+		m_tabHandleWidgetsTimer = startTimer(0);
+	}
 }
 
 void TabBarWidget::enterEvent(QEvent *event)
@@ -914,7 +969,7 @@ void TabBarWidget::mouseMoveEvent(QMouseEvent *event)
 				mimeData->setProperty("x-url-title", window->getTitle());
 				mimeData->setProperty("x-window-identifier", window->getIdentifier());
 
-				const QPixmap thumbnail(window->createThumbnail());
+				const QPixmap thumbnail(ThumbnailsManager::getThumbnail(window));
 				QDrag *drag(new QDrag(this));
 				drag->setMimeData(mimeData);
 				drag->setPixmap(thumbnail.isNull() ? window->getIcon().pixmap(16, 16) : thumbnail);
@@ -1008,17 +1063,7 @@ void TabBarWidget::dropEvent(QDropEvent *event)
 
 		if (event->source() == this)
 		{
-			for (int i = 0; i < count(); ++i)
-			{
-				const Window *window(getWindow(i));
-
-				if (window && window->getIdentifier() == windowIdentifier)
-				{
-					previousIndex = i;
-
-					break;
-				}
-			}
+			previousIndex = getWindowIndex(windowIdentifier);
 		}
 
 		if (previousIndex < 0)
@@ -1061,10 +1106,12 @@ void TabBarWidget::dropEvent(QDropEvent *event)
 
 			if (urls.isEmpty())
 			{
-				const InputInterpreter::InterpreterResult result(InputInterpreter::interpret(event->mimeData()->text(), (InputInterpreter::NoBookmarkKeywordsFlag | InputInterpreter::NoSearchKeywordsFlag)));
+				InputInterpreter *interpreter(new InputInterpreter(mainWindow));
 
-				if (result.isValid())
+				connect(interpreter, &InputInterpreter::finished, mainWindow, [=](const InputInterpreter::InterpreterResult &result)
 				{
+					interpreter->deleteLater();
+
 					switch (result.type)
 					{
 						case InputInterpreter::InterpreterResult::UrlType:
@@ -1078,7 +1125,9 @@ void TabBarWidget::dropEvent(QDropEvent *event)
 						default:
 							break;
 					}
-				}
+				});
+
+				interpreter->start(event->mimeData()->text(), (InputInterpreter::NoBookmarkKeywordsFlag | InputInterpreter::NoSearchKeywordsFlag));
 			}
 			else
 			{
@@ -1135,20 +1184,27 @@ void TabBarWidget::tabLayoutChange()
 {
 	QTabBar::tabLayoutChange();
 
-	for (int i = 0; i < count(); ++i)
+	QHash<quint64, TabHandleWidget*>::const_iterator iterator;
+
+	for (iterator = m_tabHandleWidgets.constBegin(); iterator != m_tabHandleWidgets.constEnd(); ++iterator)
 	{
-		QWidget *tabHandleWidget(tabButton(i, QTabBar::LeftSide));
+		const int index(getWindowIndex(iterator.key()));
 
-		if (tabHandleWidget)
+		if (index >= 0)
 		{
 			QStyleOptionTab tabOption;
 
-			initStyleOption(&tabOption, i);
+			initStyleOption(&tabOption, index);
 
-			tabHandleWidget->resize(style()->subElementRect(QStyle::SE_TabBarTabLeftButton, &tabOption, this).size());
+			iterator.value()->resize(style()->subElementRect(QStyle::SE_TabBarTabLeftButton, &tabOption, this).size());
 		}
 	}
 
+	if (m_tabHandleWidgetsTimer == 0)
+	{
+		m_tabHandleWidgetsTimer = startTimer(0);
+	}
+
 	tabHovered(tabAt(mapFromGlobal(QCursor::pos())));
 }
 
@@ -1213,22 +1269,32 @@ void TabBarWidget::addTab(int index, Window *window)
 {
 	const int selectedIndex(currentIndex());
 
+	index = qBound(0, index, count());
+
+	m_windows.insert(index, window);
+
+	updateWindowIndexes(index, (m_windows.count() - 1));
 	blockSignals(true);
 	insertTab(index, {});
 	blockSignals(false);
-	setTabButton(index, QTabBar::LeftSide, new TabHandleWidget(window, this));
 	setTabButton(index, QTabBar::RightSide, nullptr);
 
+	if (tabRect(index).intersects(rect()))
+	{
+		createTabHandleWidget(index);
+	}
+
 	if (selectedIndex != currentIndex() || count() == 1)
 	{
 		emit currentChanged(currentIndex());
 	}
 
-	connect(window, &Window::isPinnedChanged, this, &TabBarWidget::updatePinnedTabsAmount);
+	connect(window, &Window::isPinnedChanged, this, &TabBarWidget::handleWindowIsPinnedChanged);
+	connect(window, &Window::needsAttention, this, &TabBarWidget::handleWindowNeedsAttention);
 
 	if (window->isPinned())
 	{
-		updatePinnedTabsAmount();
+		handleWindowIsPinnedChanged(true);
 	}
 }
 
@@ -1243,6 +1309,15 @@ void TabBarWidget::removeTab(int index)
 
 	if (window)
 	{
+		disconnect(window, &Window::isPinnedChanged, this, &TabBarWidget::handleWindowIsPinnedChanged);
+		disconnect(window, &Window::needsAttention, this, &TabBarWidget::handleWindowNeedsAttention);
+
+		m_windows.remove(index);
+		m_windowIndexes.remove(window->getIdentifier());
+		m_tabHandleWidgets.remove(window->getIdentifier());
+
+		updateWindowIndexes(index, (m_windows.count() - 1));
+
 		window->deleteLater();
 	}
 
@@ -1250,8 +1325,7 @@ void TabBarWidget::removeTab(int index)
 
 	if (window && window->isPinned())
 	{
-		updatePinnedTabsAmount();
-		updateSize();
+		handleWindowIsPinnedChanged(false);
 	}
 
 	if (underMouse() && tabAt(mapFromGlobal(QCursor::pos())) < 0)
@@ -1262,6 +1336,63 @@ void TabBarWidget::removeTab(int index)
 	}
 }
 
+void TabBarWidget::updateTabHandleWidgets()
+{
+	if (count() == 0)
+	{
+		return;
+	}
+
+	int firstIndex(findTab(rect().topLeft()));
+	int lastIndex(findTab(rect().bottomRight()));
+
+	if (firstIndex > lastIndex)
+	{
+		qSwap(firstIndex, lastIndex);
+	}
+
+	const int margin(lastIndex - firstIndex + 1);
+	const int selectedIndex(currentIndex());
+
+	firstIndex = qMax(0, (firstIndex - margin));
+	lastIndex = qMin((count() - 1), (lastIndex + margin));
+
+	QHash<quint64, TabHandleWidget*>::iterator iterator(m_tabHandleWidgets.begin());
+
+	while (iterator != m_tabHandleWidgets.end())
+	{
+		const int index(getWindowIndex(iterator.key()));
+
+		if (index >= 0 && (index < firstIndex || index > lastIndex) && index != selectedIndex && !iterator.value()->isNeedingAttention())
+		{
+			TabHandleWidget *tabHandleWidget(iterator.value());
+
+			iterator = m_tabHandleWidgets.erase(iterator);
+
+			setTabButton(index, QTabBar::LeftSide, nullptr);
+
+			tabHandleWidget->deleteLater();
+		}
+		else
+		{
+			++iterator;
+		}
+	}
+
+	for (int i = firstIndex; i <= lastIndex; ++i)
+	{
+		createTabHandleWidget(i);
+	}
+}
+
+void TabBarWidget::updateWindowIndexes(int from, int to)
+{
+	for (int i = qMax(0, from); i <= to && i < m_windows.count(); ++i)
+	{
+		m_windowIndexes[m_windows.at(i)->getIdentifier()] = i;
+	}
+}
+
 void TabBarWidget::showPreview(int index, int delay)
 {
 	if (delay > 0)
@@ -1302,7 +1433,7 @@ void TabBarWidget::showPreview(int index, int delay)
 
 		const bool isActive(index == currentIndex());
 
-		m_previewWidget->setPreview(window->getTitle(), ((isActive || m_areThumbnailsEnabled) ? QPixmap() : window->createThumbnail()), isActive);
+		m_previewWidget->setPreview(window->getTitle(), ((isActive || m_areThumbnailsEnabled) ? QPixmap() : ThumbnailsManager::getThumbnail(window)), isActive);
 
 		switch (shape())
 		{
@@ -1509,7 +1640,7 @@ void TabBarWidget::handleCurrentChanged(int index)
 		showPreview(tabAt(mapFromGlobal(QCursor::pos())));
 	}
 
-	TabHandleWidget *tabHandleWidget(qobject_cast<TabHandleWidget*>(tabButton(index, QTabBar::LeftSide)));
+	TabHandleWidget *tabHandleWidget(createTabHandleWidget(index));
 
 	if (tabHandleWidget)
 	{
@@ -1524,28 +1655,42 @@ void TabBarWidget::handleCurrentChanged(int index)
 	m_activeTabHandleWidget = tabHandleWidget;
 }
 
-void TabBarWidget::updatePinnedTabsAmount()
+void TabBarWidget::handleTabMoved(int from, int to)
 {
-	int amount(0);
-
-	for (int i = 0; i < count(); ++i)
+	if (from < 0 || to < 0 || from >= m_windows.count() || to >= m_windows.count())
 	{
-		const Window *window(getWindow(i));
-
-		if (window && window->isPinned())
-		{
-			++amount;
-		}
+		return;
 	}
 
-	if (amount != m_pinnedTabsAmount)
+	m_windows.move(from, to);
+
+	updateWindowIndexes(qMin(from, to), qMax(from, to));
+}
+
+void TabBarWidget::handleWindowNeedsAttention()
+{
+	const Window *window(qobject_cast<Window*>(sender()));
+
+	if (!window)
 	{
-		m_pinnedTabsAmount = amount;
+		return;
+	}
 
-		updateSize();
+	TabHandleWidget *tabHandleWidget(createTabHandleWidget(getWindowIndex(window->getIdentifier())));
+
+	if (tabHandleWidget)
+	{
+		tabHandleWidget->markAsNeedingAttention();
 	}
 }
 
+void TabBarWidget::handleWindowIsPinnedChanged(bool isPinned)
+{
+	m_pinnedTabsAmount = qMax(0, (m_pinnedTabsAmount + (isPinned ? 1 : -1)));
+
+	updateSize();
+}
+
 void TabBarWidget::updateSize()
 {
 	updateGeometry();
@@ -1594,17 +1739,35 @@ void TabBarWidget::setArea(Qt::ToolBarArea area)
 
 Window* TabBarWidget::getWindow(int index) const
 {
-	if (index >= 0 && index < count())
+	return m_windows.value(index, nullptr);
+}
+
+TabHandleWidget* TabBarWidget::createTabHandleWidget(int index)
+{
+	Window *window(getWindow(index));
+
+	if (!window)
 	{
-		const TabHandleWidget *widget(qobject_cast<TabHandleWidget*>(tabButton(index, QTabBar::LeftSide)));
+		return nullptr;
+	}
 
-		if (widget)
-		{
-			return widget->getWindow();
-		}
+	if (m_tabHandleWidgets.contains(window->getIdentifier()))
+	{
+		return m_tabHandleWidgets[window->getIdentifier()];
 	}
 
-	return nullptr;
+	TabHandleWidget *tabHandleWidget(new TabHandleWidget(window, this));
+
+	m_tabHandleWidgets[window->getIdentifier()] = tabHandleWidget;
+
+	setTabButton(index, QTabBar::LeftSide, tabHandleWidget);
+
+	if (index == currentIndex())
+	{
+		tabHandleWidget->setIsActiveWindow(true);
+	}
+
+	return tabHandleWidget;
 }
 
 QStyleOptionTab TabBarWidget::createStyleOptionTab(int index) const
@@ -1664,14 +1827,7 @@ QSize TabBarWidget::sizeHint() const
 {
 	if (shape() == QTabBar::RoundedNorth || shape() == QTabBar::RoundedSouth)
 	{
-		int size(0);
-
-		for (int i = 0; i < count(); ++i)
-		{
-			const Window *window(getWindow(i));
-
-			size += ((window && window->isPinned()) ? m_minimumTabSize.width() : m_maximumTabSize.width());
-		}
+		int size((m_pinnedTabsAmount * m_minimumTabSize.width()) + ((count() - m_pinnedTabsAmount) * m_maximumTabSize.width()));
 
 		if (parentWidget() && size > parentWidget()->width())
 		{
@@ -1684,6 +1840,37 @@ QSize TabBarWidget::sizeHint() const
 	return {QTabBar::sizeHint().width(), (tabSizeHint(0).height() * count())};
 }
 
+int TabBarWidget::findTab(const QPoint &position) const
+{
+	if (count() == 0)
+	{
+		return -1;
+	}
+
+	const bool isHorizontal(shape() == QTabBar::RoundedNorth || shape() == QTabBar::RoundedSouth);
+	const bool isReversed(isHorizontal && isRightToLeft());
+	const int value(isHorizontal ? position.x() : position.y());
+	int low(0);
+	int high(count() - 1);
+
+	while (low < high)
+	{
+		const int middle((low + high) / 2);
+		const QRect rectangle(tabRect(middle));
+
+		if (isReversed ? (value < rectangle.left()) : (value > (isHorizontal ? rectangle.right() : rectangle.bottom())))
+		{
+			low = (middle + 1);
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	return low;
+}
+
 int TabBarWidget::getDropIndex() const
 {
 	if (m_dragMovePosition.isNull())
@@ -1711,6 +1898,11 @@ int TabBarWidget::getDropIndex() const
 	return index;
 }
 
+int TabBarWidget::getWindowIndex(quint64 identifier) const
+{
+	return m_windowIndexes.value(identifier, -1);
+}
+
 bool TabBarWidget::areThumbnailsEnabled()
 {
 	return m_areThumbnailsEnabled;
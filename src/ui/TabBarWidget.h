@@ -40,8 +40,10 @@ class TabHandleWidget final : public QWidget
 public:
 	explicit TabHandleWidget(Window *window, TabBarWidget *parent);
 
+	void markAsNeedingAttention();
 	void setIsActiveWindow(bool isActive);
 	Window* getWindow() const;
+	bool isNeedingAttention() const;
 
 protected:
 	void timerEvent(QTimerEvent *event) override;
@@ -55,7 +57,6 @@ protected:
 	void dragEnterEvent(QDragEnterEvent *event) override;
 
 protected slots:
-	void markAsNeedingAttention();
 	void handleLoadingStateChanged(WebWidget::LoadingState state);
 	void updateGeometries();
 	void updateTitle();
@@ -71,6 +72,7 @@ private:
 	QRect m_titleRectangle;
 	int m_dragTimer;
 	bool m_isActiveWindow;
+	bool m_isNeedingAttention;
 	bool m_isCloseButtonUnderMouse;
 	bool m_wasCloseButtonPressed;
 
@@ -92,6 +94,7 @@ public:
 	Window* getWindow(int index) const;
 	QSize minimumSizeHint() const override;
 	QSize sizeHint() const override;
+	int getWindowIndex(quint64 identifier) const;
 	static bool areThumbnailsEnabled();
 	static bool isLayoutReversed();
 	static bool isCloseButtonEnabled();
@@ -120,15 +123,21 @@ protected:
 	void tabInserted(int index) override;
 	void tabRemoved(int index) override;
 	void tabHovered(int index);
+	void updateTabHandleWidgets();
+	void updateWindowIndexes(int from, int to);
+	TabHandleWidget* createTabHandleWidget(int index);
 	QStyleOptionTab createStyleOptionTab(int index) const;
 	QSize tabSizeHint(int index) const override;
+	int findTab(const QPoint &position) const;
 	int getDropIndex() const;
 	bool event(QEvent *event) override;
 
 protected slots:
 	void handleOptionChanged(int identifier, const QVariant &value);
 	void handleCurrentChanged(int index);
-	void updatePinnedTabsAmount();
+	void handleTabMoved(int from, int to);
+	void handleWindowIsPinnedChanged(bool isPinned);
+	void handleWindowNeedsAttention();
 	void updateStyle();
 	void setArea(Qt::ToolBarArea area);
 
@@ -136,6 +145,9 @@ private:
 	PreviewWidget *m_previewWidget;
 	QPointer<TabHandleWidget> m_activeTabHandleWidget;
 	QPointer<QWidget> m_movableTabWidget;
+	QVector<Window*> m_windows;
+	QHash<quint64, int> m_windowIndexes;
+	QHash<quint64, TabHandleWidget*> m_tabHandleWidgets;
 	QPoint m_dragMovePosition;
 	QPoint m_dragStartPosition;
 	QSize m_maximumTabSize;
@@ -146,6 +158,7 @@ private:
 	int m_hoveredTab;
 	int m_pinnedTabsAmount;
 	int m_previewTimer;
+	int m_tabHandleWidgetsTimer;
 	bool m_arePreviewsEnabled;
 	bool m_isDraggingTab;
 	bool m_isDetachingTab;
@@ -605,7 +605,7 @@ void WebWidget::setOption(int identifier, const QVariant &value)
 		m_options[identifier] = value;
 	}
 
-	SessionsManager::markSessionAsModified();
+	SessionsManager::markSessionAsModified(getWindowIdentifier());
 
 	switch (identifier)
 	{
@@ -1431,8 +1431,11 @@ QVector<WebWidget::LinkUrl> WebWidget::getSearchEngines() const
 	return {};
 }
 
-QVector<NetworkManager::ResourceInformation> WebWidget::getBlockedRequests() const
+QVector<NetworkManager::ResourceInformation> WebWidget::getBlockedRequests(int from, int amount) const
 {
+	Q_UNUSED(from)
+	Q_UNUSED(amount)
+
 	return {};
 }
 
@@ -1602,6 +1605,13 @@ quint64 WebWidget::getWindowIdentifier() const
 	return m_windowIdentifier;
 }
 
+int WebWidget::getBlockedRequestsAmount(int profile) const
+{
+	Q_UNUSED(profile)
+
+	return 0;
+}
+
 int WebWidget::getAmountOfDeferredPlugins() const
 {
 	return 0;
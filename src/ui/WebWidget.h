@@ -36,6 +36,8 @@
 #include <QtPrintSupport/QPrinter>
 #include <QtWidgets/QWidget>
 
+#include <functional>
+
 namespace Otter
 {
 
@@ -197,7 +199,8 @@ public:
 	};
 
 	virtual void search(const QString &query, const QString &searchEngine);
-	virtual void print(QPrinter *printer) = 0;
+	virtual void print(QPrinter *printer, const std::function<void(bool)> &callback) = 0;
+	virtual void findInPage(const QString &text, FindFlags flags = NoFlagsFind) = 0;
 	void startWatchingChanges(QObject *object, ChangeWatcher watcher);
 	void stopWatchingChanges(QObject *object, ChangeWatcher watcher);
 	void showDialog(ContentsDialog *dialog, bool lockEventLoop = true);
@@ -236,15 +239,15 @@ public:
 	virtual QVector<LinkUrl> getFeeds() const;
 	virtual QVector<LinkUrl> getLinks() const;
 	virtual QVector<LinkUrl> getSearchEngines() const;
-	virtual QVector<NetworkManager::ResourceInformation> getBlockedRequests() const;
+	virtual QVector<NetworkManager::ResourceInformation> getBlockedRequests(int from = 0, int amount = -1) const;
 	QHash<int, QVariant> getOptions() const;
 	virtual QMap<QByteArray, QByteArray> getHeaders() const;
 	virtual QMultiMap<QString, QString> getMetaData() const;
 	virtual WebWidget::ContentStates getContentState() const;
 	virtual WebWidget::LoadingState getLoadingState() const = 0;
 	quint64 getWindowIdentifier() const;
+	virtual int getBlockedRequestsAmount(int profile = -1) const;
 	virtual int getZoom() const = 0;
-	virtual int findInPage(const QString &text, FindFlags flags = NoFlagsFind) = 0;
 	bool hasOption(int identifier) const;
 	virtual bool hasSelection() const;
 	virtual bool hasWatchedChanges(ChangeWatcher watcher) const;
@@ -343,6 +346,7 @@ signals:
 	void urlChanged(const QUrl &url);
 	void iconChanged(const QIcon &icon);
 	void requestBlocked(const NetworkManager::ResourceInformation &request);
+	void findInPageResultsChanged(const QString &query, int matchesAmount);
 	void arbitraryActionsStateChanged(const QVector<int> &identifiers);
 	void categorizedActionsStateChanged(const QVector<int> &categories);
 	void contentStateChanged(WebWidget::ContentStates state);
@@ -25,6 +25,7 @@
 #include "../core/Application.h"
 #include "../core/HistoryManager.h"
 #include "../core/SettingsManager.h"
+#include "../core/ThumbnailsManager.h"
 #include "../core/Utils.h"
 #include "../modules/widgets/address/AddressWidget.h"
 #include "../modules/widgets/search/SearchWidget.h"
@@ -81,6 +82,29 @@ Window::Window(const QVariantMap &parameters, ContentsWidget *widget, MainWindow
 	}
 
 	connect(this, &Window::titleChanged, this, &Window::setWindowTitle);
+	connect(this, &Window::titleChanged, this, [&]()
+	{
+		SessionsManager::markSessionAsModified(m_identifier);
+	});
+	connect(this, &Window::aboutToNavigate, this, [&]()
+	{
+		ThumbnailsManager::removeThumbnail(m_identifier);
+	});
+	connect(this, &Window::aboutToClose, this, [&]()
+	{
+		ThumbnailsManager::removeThumbnail(m_identifier);
+	});
+	connect(this, &Window::loadingStateChanged, this, [&](WebWidget::LoadingState state)
+	{
+		if (state == WebWidget::OngoingLoadingState)
+		{
+			ThumbnailsManager::removeThumbnail(m_identifier);
+		}
+		else if (state == WebWidget::FinishedLoadingState && (SettingsManager::getOption(SettingsManager::TabBar_EnableThumbnailsOption).toBool() || SettingsManager::getOption(SettingsManager::TabBar_EnablePreviewsOption).toBool()))
+		{
+			ThumbnailsManager::scheduleThumbnail(this);
+		}
+	});
 	connect(mainWindow, &MainWindow::toolBarStateChanged, this, &Window::handleToolBarStateChanged);
 }
 
@@ -213,6 +237,14 @@ void Window::requestClose()
 	}
 }
 
+void Window::resume()
+{
+	if (!m_contentsWidget && !m_isAboutToClose)
+	{
+		setUrl(m_session.getUrl(), false);
+	}
+}
+
 void Window::search(const QString &query, const QString &searchEngine)
 {
 	WebContentsWidget *widget(qobject_cast<WebContentsWidget*>(m_contentsWidget));
@@ -250,10 +282,7 @@ void Window::markAsActive(bool updateLastActivity)
 		m_suspendTimer = 0;
 	}
 
-	if (!m_contentsWidget)
-	{
-		setUrl(m_session.getUrl(), false);
-	}
+	resume();
 
 	if (updateLastActivity)
 	{
@@ -341,7 +370,7 @@ void Window::setOption(int identifier, const QVariant &value)
 			m_session.options[identifier] = value;
 		}
 
-		SessionsManager::markSessionAsModified();
+		SessionsManager::markSessionAsModified(m_identifier);
 
 		emit optionChanged(identifier, value);
 	}
@@ -468,6 +497,8 @@ void Window::setContentsWidget(ContentsWidget *widget)
 
 	if (m_session.history.index >= 0 || !m_contentsWidget->getWebWidget() || m_contentsWidget->getWebWidget()->getRequestedUrl().isEmpty())
 	{
+		m_session.history.decode();
+
 		m_contentsWidget->setHistory(m_session.history);
 		m_contentsWidget->setZoom(m_session.getZoom());
 	}
@@ -493,6 +524,8 @@ void Window::setContentsWidget(ContentsWidget *widget)
 
 	m_session = Session::Window();
 
+	SessionsManager::markSessionAsModified(m_identifier);
+
 	emit titleChanged(m_contentsWidget->getTitle());
 	emit urlChanged(m_contentsWidget->getUrl(), false);
 	emit iconChanged(m_contentsWidget->getIcon());
@@ -677,20 +710,27 @@ Session::Window::History Window::getHistory() const
 		return m_contentsWidget->getHistory();
 	}
 
-	return m_session.history;
+	Session::Window::History history(m_session.history);
+	history.decode();
+
+	return history;
 }
 
-Session::Window Window::getSession() const
+Session::Window Window::getSession(bool includeContents) const
 {
 	Session::Window session;
 
 	if (m_contentsWidget)
 	{
-		session.history = m_contentsWidget->getHistory();
 		session.parentGroup = 0;
 		session.isPinned = isPinned();
 
-		if (m_contentsWidget->getType() == QLatin1String("web"))
+		if (includeContents)
+		{
+			session.history = m_contentsWidget->getHistory();
+		}
+
+		if (includeContents && m_contentsWidget->getType() == QLatin1String("web"))
 		{
 			const WebContentsWidget *webWidget(qobject_cast<WebContentsWidget*>(m_contentsWidget));
 
@@ -779,4 +819,9 @@ bool Window::isPrivate() const
 	return ((m_contentsWidget && !m_isAboutToClose) ? m_contentsWidget->isPrivate() : SessionsManager::calculateOpenHints(m_parameters).testFlag(SessionsManager::PrivateOpen));
 }
 
+bool Window::isSuspended() const
+{
+	return !m_contentsWidget;
+}
+
 }
@@ -69,7 +69,7 @@ public:
 	QDateTime getLastActivity() const;
 	ActionsManager::ActionDefinition::State getActionState(int identifier, const QVariantMap &parameters = {}) const override;
 	Session::Window::History getHistory() const;
-	Session::Window getSession() const;
+	Session::Window getSession(bool includeContents = true) const;
 	QSize sizeHint() const override;
 	WebWidget::LoadingState getLoadingState() const;
 	WebWidget::ContentStates getContentState() const;
@@ -81,10 +81,12 @@ public:
 	bool isActive() const;
 	bool isPinned() const;
 	bool isPrivate() const;
+	bool isSuspended() const;
 
 public slots:
 	void triggerAction(int identifier, const QVariantMap &parameters = {}, ActionsManager::TriggerType trigger = ActionsManager::UnknownTrigger) override;
 	void requestClose();
+	void resume();
 	void search(const QString &query, const QString &searchEngine);
 	void markAsActive(bool updateLastActivity = true);
 	void setUrl(const QUrl &url, bool isTyped = true);
@@ -544,20 +544,29 @@ void WorkspaceWidget::addWindow(Window *window, const Session::Window::State &st
 		QMdiSubWindow *activeWindow(m_mdi->currentSubWindow());
 		MdiWindow *mdiWindow(new MdiWindow(window, m_mdi));
 		QMenu *menu(new QMenu(mdiWindow));
-		menu->addAction(new Action(ActionsManager::CloseTabAction, {}, {{QLatin1String("icon"), {}}, {QLatin1String("text"), QT_TRANSLATE_NOOP("actions", "Close")}}, windowExecutor, menu));
-		menu->addAction(new Action(ActionsManager::RestoreTabAction, {}, windowExecutor, menu));
-		menu->addAction(new Action(ActionsManager::MinimizeTabAction, {}, windowExecutor, menu));
-		menu->addAction(new Action(ActionsManager::MaximizeTabAction, {}, windowExecutor, menu));
-		menu->addAction(new Action(ActionsManager::AlwaysOnTopTabAction, {}, windowExecutor, menu));
-		menu->addSeparator();
-
-		QMenu *arrangeMenu(menu->addMenu(tr("Arrange")));
-		arrangeMenu->addAction(new Action(ActionsManager::RestoreAllAction, {}, mainWindowExecutor, arrangeMenu));
-		arrangeMenu->addAction(new Action(ActionsManager::MaximizeAllAction, {}, mainWindowExecutor, arrangeMenu));
-		arrangeMenu->addAction(new Action(ActionsManager::MinimizeAllAction, {}, mainWindowExecutor, arrangeMenu));
-		arrangeMenu->addSeparator();
-		arrangeMenu->addAction(new Action(ActionsManager::CascadeAllAction, {}, mainWindowExecutor, arrangeMenu));
-		arrangeMenu->addAction(new Action(ActionsManager::TileAllAction, {}, mainWindowExecutor, arrangeMenu));
+
+		connect(menu, &QMenu::aboutToShow, menu, [=]()
+		{
+			if (!menu->isEmpty())
+			{
+				return;
+			}
+
+			menu->addAction(new Action(ActionsManager::CloseTabAction, {}, {{QLatin1String("icon"), {}}, {QLatin1String("text"), QT_TRANSLATE_NOOP("actions", "Close")}}, windowExecutor, menu));
+			menu->addAction(new Action(ActionsManager::RestoreTabAction, {}, windowExecutor, menu));
+			menu->addAction(new Action(ActionsManager::MinimizeTabAction, {}, windowExecutor, menu));
+			menu->addAction(new Action(ActionsManager::MaximizeTabAction, {}, windowExecutor, menu));
+			menu->addAction(new Action(ActionsManager::AlwaysOnTopTabAction, {}, windowExecutor, menu));
+			menu->addSeparator();
+
+			QMenu *arrangeMenu(menu->addMenu(tr("Arrange")));
+			arrangeMenu->addAction(new Action(ActionsManager::RestoreAllAction, {}, mainWindowExecutor, arrangeMenu));
+			arrangeMenu->addAction(new Action(ActionsManager::MaximizeAllAction, {}, mainWindowExecutor, arrangeMenu));
+			arrangeMenu->addAction(new Action(ActionsManager::MinimizeAllAction, {}, mainWindowExecutor, arrangeMenu));
+			arrangeMenu->addSeparator();
+			arrangeMenu->addAction(new Action(ActionsManager::CascadeAllAction, {}, mainWindowExecutor, arrangeMenu));
+			arrangeMenu->addAction(new Action(ActionsManager::TileAllAction, {}, mainWindowExecutor, arrangeMenu));
+		});
 
 		mdiWindow->show();
 		mdiWindow->lower();